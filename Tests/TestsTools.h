@@ -12,6 +12,7 @@
 #define TESTS_TOOLS_DEFAULT_ACCURACY 1E-13
 
 #import "../computational-physics/math/containers.hpp"
+#import "../computational-physics/math/differential_equations/SolveEDP.h"
 
 
 @interface TestsTools : NSObject
@@ -26,6 +27,17 @@
          withExpected: (cda::math::containers::Vector<double>) expected
          whitAccuracy: (double) accuracy;
 
+// Wave equation starting at time 0 with dt 1E-03, speed as Q2D and no flux on every border
++ (void)setWaveEquation: (cda::math::differential_equations::EDP &) equation
+              withSpeed: (cda::math::differential_equations::EDP_T (*)(cda::math::differential_equations::EDP_T,
+                                                                      cda::math::differential_equations::EDP_T)) speed;
+
+// Evenly spaced unit membrane with columns points along x and rows points along y
++ (void)setUnitMembraneX: (cda::math::containers::Vector<double> &) x
+                 columns: (size_t) columns
+                       y: (cda::math::containers::Vector<double> &) y
+                    rows: (size_t) rows;
+
 @end
 
 #endif /* Tools_h */
@@ -11,6 +11,12 @@
 #import "TestsTools.h"
 
 
+static cda::math::differential_equations::EDP_T no_flux(cda::math::differential_equations::EDP_T,
+                                                         cda::math::differential_equations::EDP_T) {
+    return 0.0;
+}
+
+
 @implementation TestsTools
 
 + (void)setDefaultWorkingDirectory {
@@ -62,4 +68,29 @@
     return YES;
 }
 
++ (void)setWaveEquation: (cda::math::differential_equations::EDP &) equation
+              withSpeed: (cda::math::differential_equations::EDP_T (*)(cda::math::differential_equations::EDP_T,
+                                                                      cda::math::differential_equations::EDP_T)) speed {
+    
+    equation.time = 0.0;
+    equation.dt = 1E-03;
+    equation.Q2D = speed;
+    equation.BCT = equation.BCL = equation.BCR = equation.BCB = no_flux;
+}
+
++ (void)setUnitMembraneX: (cda::math::containers::Vector<double> &) x
+                 columns: (size_t) columns
+                       y: (cda::math::containers::Vector<double> &) y
+                    rows: (size_t) rows {
+    
+    x = cda::math::containers::Vector<double>(columns);
+    y = cda::math::containers::Vector<double>(rows);
+    for (size_t j = 0; j < columns; ++j) {
+        x[j] = j / (columns - 1.0);
+    }
+    for (size_t i = 0; i < rows; ++i) {
+        y[i] = i / (rows - 1.0);
+    }
+}
+
 @end
@@ -0,0 +1,133 @@
+//
+//  FFTTests.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import <cmath>
+#import <complex>
+#import <vector>
+
+#import "../../../TestsTools.h"
+#import "../../../../computational-physics/math/algorithms/transforms/fft.hpp"
+
+using namespace cda::math::algorithms::transforms;
+
+
+//  Valores de prueba sin periodicidad: cualquier error de índices cambia el resultado
+static double sample(const size_t &j, const double &phase) {
+    return std::sin(1.3 * j + phase) + 0.1 * j;
+}
+
+
+@interface FFTTests : XCTestCase
+
+@end
+
+@implementation FFTTests
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testMatchesDirectSum {
+    //  Potencias de dos (radix 2) y longitudes arbitrarias (Bluestein)
+    for (const size_t size : {1, 2, 8, 64, 3, 7, 39, 100}) {
+        FFT<double> fft(size);
+        std::vector<std::complex<double>> data(size), buffer;
+        for (size_t j = 0; j < size; ++j) {
+            data[j] = std::complex<double>(sample(j, 0), sample(j, 1));
+        }
+        const std::vector<std::complex<double>> original = data;
+
+        fft.forward(data.data(), buffer);
+
+        double error = 0;
+        for (size_t k = 0; k < size; ++k) {
+            std::complex<double> sum = 0;
+            for (size_t j = 0; j < size; ++j) {
+                sum += original[j] * std::polar(1.0, -2.0 * M_PI * double((j * k) % size) / size);
+            }
+            error = std::max(error, std::abs(sum - data[k]));
+        }
+        XCTAssertLessThan(error, 1E-12, "FFT of length %zu OK", size);
+    }
+
+    XCTAssertThrows(FFT<double>(0), "Empty transform");
+}
+
+- (void)testTrigonometricTransforms {
+    typedef TrigonometricTransform<double> Transform;
+
+    for (const size_t size : {2, 3, 31, 39, 64}) {
+        for (const Transform::Kind &kind : {Transform::sine, Transform::cosine}) {
+            const Transform transform(kind, size);
+            std::vector<double> first(size), second(size);
+            for (size_t j = 0; j < size; ++j) {
+                first[j] = sample(j, 0);
+                second[j] = sample(j, 2);
+            }
+            const std::vector<double> a = first, b = second;
+            std::vector<std::complex<double>> work, buffer;
+
+            transform(first.data(), second.data(), work, buffer);
+
+            double error = 0;
+            for (size_t k = 0; k < size; ++k) {
+                double sa = 0, sb = 0;
+                for (size_t j = 0; j < size; ++j) {
+                    const double basis = kind == Transform::sine ?
+                        std::sin(M_PI * (j + 1) * (k + 1) / (size + 1)) :
+                        std::cos(M_PI * j * k / (size - 1)) * ((j == 0 || j == size - 1) ? 0.5 : 1.0);
+                    sa += basis * a[j];
+                    sb += basis * b[j];
+                }
+                error = std::max(error, std::max(std::abs(sa - first[k]), std::abs(sb - second[k])));
+            }
+            XCTAssertLessThan(error, 1E-11, "Two sequences per transform");
+
+            //  Aplicada dos veces multiplica por scale()
+            transform(first.data(), nullptr, work, buffer);
+            error = 0;
+            for (size_t j = 0; j < size; ++j) {
+                error = std::max(error, std::abs(first[j] / transform.scale() - a[j]));
+            }
+            XCTAssertLessThan(error, 1E-12, "Own inverse");
+        }
+    }
+}
+
+- (void)testEigenvalues {
+    typedef TrigonometricTransform<double> Transform;
+    const size_t size = 9;
+
+    //  Cada vector de la base cumple u_(j-1) - 2u_j + u_(j+1) = λ·u_j con los extremos de la transformada
+    for (const Transform::Kind &kind : {Transform::sine, Transform::cosine}) {
+        const Transform transform(kind, size);
+        for (size_t k = 0; k < size; ++k) {
+            std::vector<double> u(size);
+            for (size_t j = 0; j < size; ++j) {
+                u[j] = kind == Transform::sine ? std::sin(M_PI * (j + 1) * (k + 1) / (size + 1)) : std::cos(M_PI * j * k / (size - 1));
+            }
+
+            double error = 0;
+            for (size_t j = 0; j < size; ++j) {
+                const double before = j > 0 ? u[j-1] : (kind == Transform::sine ? 0 : u[1]);
+                const double after = j < size - 1 ? u[j+1] : (kind == Transform::sine ? 0 : u[size-2]);
+                error = std::max(error, std::abs(before - 2 * u[j] + after - transform.eigenvalue(k) * u[j]));
+            }
+            XCTAssertLessThan(error, 1E-12, "Eigenvalue OK");
+        }
+    }
+}
+
+@end
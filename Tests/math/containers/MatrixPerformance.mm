@@ -8,6 +8,8 @@
 
 #import <XCTest/XCTest.h>
 
+#include <chrono>
+
 #import "../../TestsTools.h"
 #import "../../../computational-physics/math/containers/matrix.hpp"
 
@@ -38,8 +40,24 @@ using namespace cda::math::containers;
 
 - (void)testPerformanceMatrixProduct {
     [self measureBlock:^{
-        Matrix<double> matrix(200, 200, 1);
-        auto new_matrix = matrix * matrix;
+        for (const size_t size : {200, 500, 1000, 2000}) {
+            Matrix<double> matrix(size, size, 1);
+            
+            const auto start = std::chrono::steady_clock::now();
+            auto new_matrix = matrix * matrix;
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            
+            NSLog(@"Matrix product %zux%zu: %.2f GFLOP/s", size, size, 2.0 * size * size * size / elapsed.count() * 1E-09);
+        }
+    }];
+}
+
+- (void)testPerformanceMatrixExpression {
+    const Matrix<double> matrix1(2000, 2000, 1), matrix2(2000, 2000, 2);
+    __block Matrix<double> result(2000, 2000, 0);
+    
+    [self measureBlock:^{
+        result += 0.25 * (matrix1 - matrix2) + matrix2 / 2.0;
     }];
 }
 
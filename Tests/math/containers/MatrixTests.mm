@@ -350,6 +350,38 @@ using namespace cda::math::containers;
     XCTAssertEqual(matrix1_copy *= 2, expected3, "Product between matrix and scalar OK");
 }
 
+- (void)testBlockedProducts {
+    //  Sizes crossing register tiles and cache blocks of the GEMM kernel
+    const size_t sizes[][3] = {{1, 1, 1}, {7, 5, 9}, {131, 257, 67}, {97, 600, 301}};
+    
+    for (const auto &size : sizes) {
+        const size_t rows = size[0], inner = size[1], columns = size[2];
+        
+        Matrix<double> matrix1(rows, inner), matrix2(inner, columns);
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < inner; ++j) {
+                matrix1[i][j] = static_cast<double>((i * 7 + j * 3) % 11) - 5;
+            }
+        }
+        for (size_t i = 0; i < inner; ++i) {
+            for (size_t j = 0; j < columns; ++j) {
+                matrix2[i][j] = static_cast<double>((i * 5 + j * 13) % 9) - 4;
+            }
+        }
+        
+        Matrix<double> expected(rows, columns, 0);
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t k = 0; k < inner; ++k) {
+                for (size_t j = 0; j < columns; ++j) {
+                    expected[i][j] += matrix1[i][k] * matrix2[k][j];
+                }
+            }
+        }
+        
+        XCTAssertEqual(matrix1 * matrix2, expected, "Blocked product %zux%zux%zu OK", rows, inner, columns);
+    }
+}
+
 - (void)testDivisions {
     Matrix<double> matrix1({
         { 0,  1,  2,  3},
@@ -416,6 +448,48 @@ using namespace cda::math::containers;
     XCTAssertEqual(-matrix, matrix * -1, "Negative matrix OK");
 }
 
+- (void)testElementWiseExpressions {
+    Matrix<double> matrix1({
+        { 0,  1,  2,  3},
+        { 4,  5,  6,  7},
+        { 8,  9, 10, 11}
+    });
+    
+    const Matrix<double> matrix2({
+        { 3,  2,  1,  0},
+        { 7,  6,  5,  4},
+        {11, 10,  9,  8}
+    });
+    
+    const Matrix<double> expected({
+        { 3,  3,  3,  3},
+        {11, 11, 11, 11},
+        {19, 19, 19, 19}
+    });
+    
+    const Matrix<double> result = matrix1 + 2.0 * (matrix2 - matrix1 / 2) / 2 - -matrix1 * 0.5;
+    XCTAssertEqual(result, expected, "Chained element-wise expression OK");
+    
+    const auto expression = matrix1 + matrix2;
+    XCTAssertEqual(expression.rows(), 3, "Expression rows OK");
+    XCTAssertEqual(expression.columns(), 4, "Expression columns OK");
+    XCTAssertEqual(expression.eval(), Matrix<double>(3, 4, 0) + matrix1 + matrix2, "Expression evaluation OK");
+    
+    XCTAssertEqual(Matrix<double>(3, 4, 1) + matrix1, matrix1 + 1.0 * Matrix<double>(3, 4, 1), "Temporaries held by the expression OK");
+    XCTAssertEqual((matrix1 + matrix2).transpose(), Matrix<double>(matrix1 + matrix2).transpose(), "Member function of an expression OK");
+    XCTAssertEqual((matrix1 * 2.0).max_element(), 22, "Member function returning a value OK");
+    
+    matrix1 = matrix1 * 2 - matrix2;
+    const Matrix<double> expected_aliasing({
+        {-3,  0,  3,  6},
+        { 1,  4,  7, 10},
+        { 5,  8, 11, 14}
+    });
+    XCTAssertEqual(matrix1, expected_aliasing, "Assignment to an operand of the expression OK");
+    
+    XCTAssertThrows(matrix1 + Matrix<double>(4, 3, 1), "Dimensions are checked when building the expression");
+}
+
 - (void)testSubtractionOfMatrices {
     Matrix<double> matrix1({
         { 3,  2,  1},
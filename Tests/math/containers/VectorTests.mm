@@ -8,6 +8,8 @@
 
 #import <XCTest/XCTest.h>
 
+#import <sstream>
+
 #import "../../TestsTools.h"
 #import "../../../computational-physics/math/containers/vector.hpp"
 
@@ -326,6 +328,30 @@ using namespace cda::math::containers;
     XCTAssertThrows(vector1 -= vector3, "Vectors size must be equal");
 }
 
+- (void)testElementWiseExpressions {
+    Vector<double> vector1({1, 2, 3, 4, 5});
+    const Vector<double> vector2({5, 4, 3, 2, 1});
+    
+    const Vector<double> expected({4, 4, 4, 4, 4});
+    const Vector<double> result = (vector1 + vector2) * 2 / 3 - -vector1 + vector1 * -1.0;
+    XCTAssertEqual(result, expected, "Chained element-wise expression OK");
+    
+    XCTAssertEqual((vector1 + vector2) * vector1, 90, "Dot product of an expression OK");
+    XCTAssertEqual((2 * vector1).size(), 5, "Expression size OK");
+    
+    XCTAssertEqual((vector1 * 4.0).sqrt(), 2.0 * vector1.sqrt(), "Member function of an expression OK");
+    XCTAssertEqual((2 * vector1).pow(2), 4.0 * vector1.pow(2), "Member function with arguments of an expression OK");
+    XCTAssertEqual((vector1 - vector2).abs_max_element(), 4, "Member function returning a value OK");
+    
+    std::ostringstream streamed, expected_stream;
+    streamed << vector1 * 2.0;
+    expected_stream << Vector<double>(vector1 * 2.0);
+    XCTAssertEqual(streamed.str(), expected_stream.str(), "Streaming an expression OK");
+    
+    vector1 = vector2 - vector1;
+    XCTAssertEqual(vector1, Vector<double>({4, 2, 0, -2, -4}), "Assignment to an operand of the expression OK");
+}
+
 - (void)testProducts {
     Vector<double> vector({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
     
@@ -0,0 +1,124 @@
+//
+//  ViewsTests.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/containers/matrix.hpp"
+
+using namespace cda::math::containers;
+
+
+@interface ViewsTests : XCTestCase
+
+@end
+
+@implementation ViewsTests
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testRowAndColumnViews {
+    Matrix<double> matrix({
+        {1, 2, 3},
+        {4, 5, 6},
+        {7, 8, 9}
+    });
+
+    XCTAssertEqual(matrix.row_view(1), Vector<double>({4, 5, 6}), "Row view OK");
+    XCTAssertEqual(matrix.row_view(1, 1), Vector<double>({5, 6}), "Partial row view OK");
+    XCTAssertEqual(matrix.column_view(1), Vector<double>({2, 5, 8}), "Column view OK");
+    XCTAssertEqual(matrix.column_view(2, 1), Vector<double>({6, 9}), "Partial column view OK");
+    XCTAssertEqual(matrix.diagonal_view(), matrix.get_diagonal(), "Diagonal view OK");
+
+    XCTAssertEqual(matrix.column_view(0).begin() + 3, matrix.column_view(0).end(), "Strided iterator OK");
+    XCTAssertEqual(matrix.column_view(2)[2], 9, "Access by index OK");
+
+    XCTAssertThrows(matrix.row_view(3), "Index out of bounds");
+    XCTAssertThrows(matrix.column_view(3), "Index out of bounds");
+    XCTAssertThrows(Matrix<double>(2, 3).diagonal_view(), "Matrix must be an square matrix");
+}
+
+- (void)testViewsWriteThrough {
+    Matrix<double> matrix(3, 3, 0);
+
+    matrix.column_view(1) = Vector<double>({1, 2, 3});
+    matrix.row_view(2) += Vector<double>({1, 1, 1});
+    matrix.diagonal_view() *= 2;
+
+    const Matrix<double> expected({
+        {0, 1, 0},
+        {0, 4, 0},
+        {1, 4, 2}
+    });
+    XCTAssertEqual(matrix, expected, "Views modify the matrix OK");
+
+    Vector<double> vector({1, 2, 3, 4, 5});
+    vector.view(1, 4).fill(0);
+    XCTAssertEqual(vector, Vector<double>({1, 0, 0, 0, 5}), "Vector view modifies the vector OK");
+
+    XCTAssertThrows(matrix.column_view(0) = vector, "Vectors must be of the same size");
+}
+
+- (void)testMatrixViews {
+    Matrix<double> matrix({
+        {1, 2, 3, 4},
+        {5, 6, 7, 8},
+        {9, 10, 11, 12}
+    });
+
+    const auto block = matrix.matrix_view(1, 1, 2, 2);
+    XCTAssertEqual(Matrix<double>(block), matrix.get_matrix(1, 1, 2, 2), "Block view OK");
+    XCTAssertEqual(Matrix<double>(block.transpose()), matrix.get_matrix(1, 1, 2, 2).transpose(), "Transposed view OK");
+    XCTAssertEqual(block.column(1), Vector<double>({7, 11}), "Column of a block OK");
+
+    const Matrix<double> sum = block + block.transpose();
+    const Matrix<double> expected({
+        {12, 17},
+        {17, 22}
+    });
+    XCTAssertEqual(sum, expected, "Views inside expressions OK");
+
+    matrix.matrix_view(0, 2, 2, 2) = matrix.matrix_view(1, 0, 2, 2);
+    XCTAssertEqual(matrix.get_row(0), Matrix<double>(1, 4, {1, 2, 5, 6}), "Block assignment OK");
+    XCTAssertEqual(matrix.get_row(1), Matrix<double>(1, 4, {5, 6, 9, 10}), "Block assignment OK");
+
+    XCTAssertThrows(matrix.matrix_view(2, 2, 2, 2), "Index out of bounds");
+}
+
+- (void)testViewAlgorithms {
+    const Matrix<double> matrix({
+        {3, -7, 1},
+        {4, 2, -9},
+        {0, 5, 8}
+    });
+
+    const auto column = matrix.column_view(1);
+    XCTAssertEqual(cda::math::algorithms::find::abs_max_element_with_sign(column.begin(), column.end()), -7, "Find through strided iterators OK");
+    XCTAssertEqual(cda::math::algorithms::find::min_element(column.begin(), column.end()), -7, "Find through strided iterators OK");
+
+    XCTAssertEqual(dot(matrix.row_view(0), matrix.column_view(0)), -19, "Dot product of views OK");
+    XCTAssertEqual(matrix.row_view(1) * matrix.row_view(1), 101, "Dot product operator of views OK");
+    XCTAssertEqual(square_norm(matrix.column_view(2)), 146, "Square norm of a view OK");
+    XCTAssertEqual(norm(matrix.row_view(1, 1)), matrix.get_row_as_vector(1, 1).norm(), "Norm of a view OK");
+
+    const Vector<double> b({1, 2, 3});
+    Matrix<double> solutions(3, 2, 0);
+    cda::math::algorithms::factorization::LU<Matrix> lu(matrix);
+    lu.solve_linear_system(b, solutions.column_view(1));
+    XCTAssertEqual(Vector<double>(solutions.column_view(1)), lu.solve_linear_system(b), "LU writes into a view OK");
+    XCTAssert(solutions.column_view(0).is_null(), "Other columns are untouched");
+}
+
+@end
@@ -0,0 +1,74 @@
+//
+//  CoefficientFieldTests.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/differential_equations/CoefficientField.h"
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+static size_t calls = 0;
+
+static double constant(double, double) {
+    ++calls;
+    return 2.5;
+}
+
+static double linear(double x, double y) {
+    ++calls;
+    return x + 10 * y;
+}
+
+
+@interface CoefficientFieldTests : XCTestCase
+
+@end
+
+@implementation CoefficientFieldTests
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+    calls = 0;
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testUniformCoefficient {
+    const Vector<double> x({0, 1, 2, 3}), y({0, 1, 2});
+
+    CoefficientField field;
+    XCTAssert(field.is_empty(), "Field is empty");
+
+    field.sample(constant, x, y);
+    XCTAssertEqual(calls, x.size() * y.size(), "Q is evaluated once per point");
+    XCTAssert(field.is_uniform(), "Constant coefficient detected");
+    XCTAssertEqual(field.value(), 2.5, "Uniform value OK");
+    XCTAssertEqual(field(2, 3), 2.5, "Element OK");
+}
+
+- (void)testSampledCoefficient {
+    const Vector<double> x({0, 1, 2, 3}), y({0, 1, 2});
+
+    CoefficientField field;
+    field.sample(linear, x, y);
+    XCTAssert(!field.is_uniform(), "Coefficient is not uniform");
+    XCTAssertEqual(field(2, 3), 23, "Element OK");
+    XCTAssertEqual(field[1][2], 12, "Row access OK");
+
+    XCTAssert(field.samples(linear, x, y), "Same function and grid");
+    XCTAssert(!field.samples(constant, x, y), "Different function");
+    XCTAssert(!field.samples(linear, Vector<double>({0, 1, 2, 4}), y), "Different grid");
+}
+
+@end
@@ -0,0 +1,176 @@
+//
+//  DistributedWaveSolver2DTests.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import <cmath>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/differential_equations/WaveSolver2D.h"
+#import "../../../computational-physics/math/differential_equations/DistributedWaveSolver2D.h"
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+static double variable_speed(double x, double y) {
+    return 1.0 + 0.5 * x * y;
+}
+
+static double speed = 1.0;
+
+static double global_speed(double x, double) {
+    return speed + 0.25 * x;
+}
+
+static double slope(double, double y) {
+    return 0.1 * y;
+}
+
+static EDP equation;
+static Vector<double> x, y;
+
+
+@interface DistributedWaveSolver2DTests : XCTestCase
+
+@end
+
+@implementation DistributedWaveSolver2DTests
+
++ (void)load {
+    //  Los rangos ejecutan de nuevo el proceso de los tests con el mismo paquete, que se carga antes del primer test
+    EDP::runRankIfRequested();
+}
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+
+    [TestsTools setWaveEquation:equation withSpeed:variable_speed];
+    equation.processes = 1;
+
+    //  Membrana unidad con 41x33 puntos
+    [TestsTools setUnitMembraneX:x columns:33 y:y rows:41];
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testMatchesSingleProcess {
+    Matrix<double> cI(y.size(), x.size(), 0);
+    const Matrix<double> cId(y.size(), x.size(), 0);
+    Matrix<bool> fixed(y.size(), x.size(), false);
+    cI[20][16] = 1.0;
+    cI[9][5] = -0.5;
+    fixed[10][10] = true;
+    fixed[20][3] = true;
+
+    const unsigned char bc = BCL_df | BCT_df | BCB_df;
+
+    for (size_t processes = 1; processes <= 4; ++processes) {
+        equation.processes = processes;
+        WaveSolver2D reference(equation, bc, x, y, cI, cId, fixed);
+        DistributedWaveSolver2D distributed(equation, bc, x, y, cI, cId, fixed);
+        XCTAssertEqual(distributed.processes(), processes, "Processes OK");
+        XCTAssertEqual(distributed.dt(), reference.dt(), "Same time step");
+
+        Matrix<double> state(y.size(), x.size());
+        reference.step();
+        distributed.step();
+        distributed.store(state);
+        XCTAssertEqual(state, reference.current(), "First step is split without changes");
+
+        reference.step(30);
+        distributed.step(30);
+        distributed.store(state);
+        XCTAssertEqual(state, reference.current(), "Halo exchange keeps the same result");
+
+        //  Fuerza externa y nuevos puntos fijos entre pasos
+        reference.current()[25][16] += 0.25;
+        state[25][16] += 0.25;
+        distributed.load(state);
+        fixed[30][20] = true;
+        reference.setFixed(fixed);
+        distributed.setFixed(fixed);
+        fixed[30][20] = false;
+
+        reference.step(20);
+        distributed.step(20);
+        distributed.store(state);
+        XCTAssertEqual(state, reference.current(), "Loaded state and fixed points are split across ranks");
+        XCTAssertEqual(distributed.steps(), reference.steps(), "Steps OK");
+        XCTAssertEqual(distributed.time(), reference.time(), "Time OK");
+    }
+}
+
+- (void)testEquationProcesses {
+    Matrix<double> cI(y.size(), x.size(), 0), cId(y.size(), x.size(), 0);
+    Matrix<bool> fixed(y.size(), x.size(), false);
+    cI[20][16] = 1.0;
+
+    EDP single, split;
+    [TestsTools setWaveEquation:single withSpeed:variable_speed];
+    [TestsTools setWaveEquation:split withSpeed:variable_speed];
+    split.processes = 3;
+
+    Matrix<double> a = cI, b = cI;
+    for (size_t step = 0; step < 10; ++step) {
+        a = single.solveWAVE(BCL_df | BCR_df, 0, x, y, a, cId, fixed, 3);
+        b = split.solveWAVE(BCL_df | BCR_df, 0, x, y, b, cId, fixed, 3);
+    }
+    XCTAssertEqual(a, b, "EDP::solveWAVE gives the same result with several processes");
+    XCTAssertEqual(single.time, split.time, "Time OK");
+}
+
+- (void)testCoefficientsAreSplit {
+    Matrix<double> cI(y.size(), x.size(), 0);
+    const Matrix<double> cId(y.size(), x.size(), 0);
+    const Matrix<bool> fixed(y.size(), x.size(), false);
+    cI[20][16] = 1.0;
+
+    //  Cada rango recibe su banda de Q2D y de los bordes, y sólo la vuelve a recibir si cambia
+    equation.Q2D = global_speed;
+    equation.BCL = equation.BCT = equation.BCB = slope;
+    const unsigned char bc = BCL_df | BCT_df | BCB_df;
+
+    equation.processes = 3;
+    WaveSolver2D reference(equation, bc, x, y, cI, cId, fixed);
+    DistributedWaveSolver2D distributed(equation, bc, x, y, cI, cId, fixed);
+
+    Matrix<double> state(y.size(), x.size());
+    for (const double value : {1.0, 0.75, 0.75}) {
+        speed = value;
+        reference.setCoefficients(equation);
+        distributed.setCoefficients(equation);
+        reference.step(10);
+        distributed.step(10);
+        distributed.store(state);
+        XCTAssertEqual(state, reference.current(), "Coefficients follow the globals of Q2D");
+    }
+
+    //  Con CACHE_COEFFICIENTS no se vuelven a muestrear
+    speed = 2.0;
+    reference.setCoefficients(equation, true);
+    distributed.setCoefficients(equation, true);
+    reference.step(10);
+    distributed.step(10);
+    distributed.store(state);
+    XCTAssertEqual(state, reference.current(), "Cached coefficients OK");
+    speed = 1.0;
+}
+
+- (void)testTooManyProcesses {
+    const Matrix<double> zero(y.size(), x.size(), 0);
+    const Matrix<bool> fixed(y.size(), x.size(), false);
+
+    equation.processes = 21;
+    XCTAssertThrows(DistributedWaveSolver2D(equation, 0, x, y, zero, zero, fixed), "Each process needs at least 2 rows");
+}
+
+@end
@@ -0,0 +1,99 @@
+//
+//  FixedMaskTests.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/differential_equations/FixedMask.h"
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+@interface FixedMaskTests : XCTestCase
+
+@end
+
+@implementation FixedMaskTests
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testBitsAndIndices {
+    //  Pared vertical con una rendija, como en los escenarios de main.cpp
+    Matrix<bool> fixed(30, 13, false);
+    for (size_t i = 0; i < fixed.rows(); ++i) {
+        fixed[i][6] = true;
+    }
+    fixed[14][6] = fixed[15][6] = false;
+    fixed[29][12] = true;
+
+    const FixedMask mask(fixed);
+    XCTAssertEqual(mask.rows(), 30, "Rows OK");
+    XCTAssertEqual(mask.columns(), 13, "Columns OK");
+    XCTAssertEqual(mask.count(), 29, "Number of fixed points OK");
+
+    bool same = true;
+    for (size_t i = 0; i < fixed.rows(); ++i) {
+        for (size_t j = 0; j < fixed.columns(); ++j) {
+            same = same && mask(i, j) == fixed[i][j];
+        }
+    }
+    XCTAssert(same, "Bits OK");
+
+    XCTAssertEqual(mask.end(0) - mask.begin(0), 1, "One fixed point in the first row");
+    XCTAssertEqual(*mask.begin(0), 6, "Column OK");
+    XCTAssertEqual(mask.begin(14), mask.end(14), "No fixed points in the slit");
+    XCTAssertEqual(mask.end(29) - mask.begin(29), 2, "Two fixed points in the last row");
+    XCTAssertEqual(mask.begin(29)[1], 12, "Columns are sorted");
+}
+
+- (void)testReassignWithoutAllocations {
+    Matrix<bool> fixed(20, 20, false);
+    fixed[3][4] = true;
+    fixed[10][11] = true;
+
+    FixedMask mask(fixed);
+
+    //  Los mismos puntos fijos en otra posición
+    fixed[3][4] = false;
+    fixed[5][6] = true;
+
+    const size_t allocations = cda::math::memory::allocation_count();
+    mask.assign(fixed);
+    XCTAssertEqual(cda::math::memory::allocation_count(), allocations, "Same number of fixed points does not allocate");
+    XCTAssert(!mask(3, 4) && mask(5, 6) && mask(10, 11), "Bits OK");
+    XCTAssertEqual(*mask.begin(5), 6, "Column OK");
+    XCTAssertEqual(mask.begin(3), mask.end(3), "Old fixed point removed");
+}
+
+- (void)testMatches {
+    Matrix<bool> fixed(20, 20, false);
+    fixed[3][4] = true;
+    fixed[10][11] = true;
+
+    const FixedMask mask(fixed);
+    XCTAssert(mask.matches(fixed), "Same fixed points");
+
+    fixed[10][12] = true;
+    XCTAssertFalse(mask.matches(fixed), "One more fixed point");
+
+    fixed[10][12] = fixed[10][11] = false;
+    fixed[10][10] = true;
+    XCTAssertFalse(mask.matches(fixed), "Same number of fixed points in another column");
+
+    XCTAssertFalse(mask.matches(Matrix<bool>(20, 21, false)), "Other dimensions");
+}
+
+@end
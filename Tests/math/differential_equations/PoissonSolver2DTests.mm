@@ -0,0 +1,393 @@
+//
+//  PoissonSolver2DTests.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import <cmath>
+#import <vector>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/differential_equations/PoissonSolver2D.h"
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+//  u = sin(πx)·sin(πy) en el cuadrado unidad: ∆u = -2π²·u
+static double source(double x, double y) {
+    return -2.0 * M_PI * M_PI * sin(M_PI * x) * sin(M_PI * y);
+}
+
+static double hot_edge(double x, double) {
+    return sin(M_PI * x);
+}
+
+static double zero(double, double) {
+    return 0.0;
+}
+
+static double flux(double, double y) {
+    return 0.5 * y;
+}
+
+static EDP equation;
+static Vector<double> x, y;
+
+
+@interface PoissonSolver2DTests : XCTestCase
+
+@end
+
+@implementation PoissonSolver2DTests
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+
+    equation.F = source;
+    equation.BCL = equation.BCR = equation.BCB = zero;
+    equation.BCT = hot_edge;
+    equation.method = GSmethod2D;
+    equation.omega = 0;
+
+    //  Cuadrado unidad con 33x41 puntos
+    x = Vector<double>(41);
+    y = Vector<double>(33);
+    for (size_t j = 0; j < x.size(); ++j) {
+        x[j] = j / 40.0;
+    }
+    for (size_t i = 0; i < y.size(); ++i) {
+        y[i] = i / 32.0;
+    }
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testOptimalOmega {
+    PoissonSolver2D dirichlet(equation, BCL_f | BCR_f | BCT_f | BCB_f, 0, x, y, false);
+    PoissonSolver2D neumann(equation, BCL_f | BCR_f | BCT_f | BCB_df, 0, x, y, false);
+
+    XCTAssertGreaterThan(dirichlet.optimalOmega(), 1.0, "Over-relaxation");
+    XCTAssertLessThan(dirichlet.optimalOmega(), 2.0, "SOR converges");
+    XCTAssertGreaterThan(neumann.optimalOmega(), dirichlet.optimalOmega(), "Derivative edges converge slower");
+}
+
+- (void)testPoissonMatchesExactSolution {
+    Matrix<double> sol(y.size(), x.size(), 0);
+    equation.BCT = zero;
+    PoissonSolver2D solver(equation, BCL_f | BCR_f | BCT_f | BCB_f, 0, x, y, true);
+    solver.dirichlet(sol);
+
+    const size_t sweeps = solver.sor(sol, 1E-12, 10000);
+    XCTAssertLessThan(sweeps, 10000, "SOR converges");
+
+    double error = 0;
+    for (size_t i = 0; i < y.size(); ++i) {
+        for (size_t j = 0; j < x.size(); ++j) {
+            error = std::max(error, std::abs(sol[i][j] - sin(M_PI * x[j]) * sin(M_PI * y[i])));
+        }
+    }
+    XCTAssertLessThan(error, 2E-03, "Discretization error only");
+}
+
+- (void)testSameSolutionAsGaussSeidel {
+    const unsigned char bcs[] = {
+        BCL_f | BCR_f | BCT_f | BCB_f,
+        BCL_f | BCR_f | BCT_f | BCB_df,
+        BCL_df | BCR_f | BCT_f | BCB_f
+    };
+    equation.BCB = flux;
+
+    for (const unsigned char &bc : bcs) {
+        Matrix<double> cI(y.size(), x.size(), 0);
+        equation.method = GSmethod2D;
+        const Matrix<double> gs = equation.solvePOISSON(bc, 0, 0, x, y, cI, 1E-11, 200000);
+        equation.method = SORmethod;
+        const Matrix<double> sor = equation.solvePOISSON(bc, 0, 0, x, y, cI, 1E-11, 200000);
+
+        double difference = 0;
+        for (size_t i = 0; i < y.size(); ++i) {
+            for (size_t j = 0; j < x.size(); ++j) {
+                difference = std::max(difference, std::abs(gs[i][j] - sor[i][j]));
+            }
+        }
+        XCTAssertLessThan(difference, 1E-06, "Red-black SOR converges to the Gauss-Seidel solution");
+    }
+}
+
+- (void)testGaussSeidelCheckStride {
+    Matrix<double> sol(y.size(), x.size(), 0);
+    PoissonSolver2D solver(equation, BCL_f | BCR_f | BCT_f | BCB_df, 0, x, y, true);
+    solver.dirichlet(sol);
+
+    Matrix<double> strided = sol;
+    const size_t every = solver.gaussSeidel(sol, 1E-09, 100000);
+    const size_t sixteen = solver.gaussSeidel(strided, 1E-09, 100000, 16);
+
+    XCTAssertEqual(sixteen % 16, 0, "Convergence checked every 16 iterations");
+    XCTAssertTrue(sixteen >= every && sixteen < every + 16, "Stops at the first check after converging");
+    XCTAssertEqualWithAccuracy(strided[16][20], sol[16][20], 1E-08, "Same solution");
+    XCTAssertEqual(solver.gaussSeidel(strided, 0, 5, 16), 5, "Last iteration is always checked");
+}
+
+- (void)testFewerSweepsThanGaussSeidel {
+    Matrix<double> sol(y.size(), x.size(), 0);
+    PoissonSolver2D solver(equation, BCL_f | BCR_f | BCT_f | BCB_f, 0, x, y, false);
+    solver.dirichlet(sol);
+
+    Matrix<double> relaxed = sol;
+    const size_t gauss_seidel = solver.sor(sol, 1E-08, 100000, 1.0);
+    const size_t sor = solver.sor(relaxed, 1E-08, 100000);
+
+    XCTAssertLessThan(sor * 10, gauss_seidel, "Optimal relaxation needs an order of magnitude fewer sweeps");
+    XCTAssertEqualWithAccuracy(relaxed[16][20], sol[16][20], 1E-05, "Same solution");
+}
+
+- (void)testMultigridMatchesExactSolution {
+    Matrix<double> sol(y.size(), x.size(), 0);
+    equation.BCT = zero;
+    PoissonSolver2D solver(equation, BCL_f | BCR_f | BCT_f | BCB_f, 0, x, y, true);
+    solver.dirichlet(sol);
+
+    std::vector<double> residuals;
+    const size_t cycles = solver.multigrid(sol, 1E-12, 100, &residuals);
+    XCTAssertLessThan(cycles, 20, "Multigrid converges in a few cycles");
+    XCTAssertEqual(residuals.size(), cycles, "One residual per cycle");
+    for (size_t k = 1; k < residuals.size(); ++k) {
+        XCTAssertLessThan(residuals[k], residuals[k-1], "Residual decreases every cycle");
+    }
+
+    double error = 0;
+    for (size_t i = 0; i < y.size(); ++i) {
+        for (size_t j = 0; j < x.size(); ++j) {
+            error = std::max(error, std::abs(sol[i][j] - sin(M_PI * x[j]) * sin(M_PI * y[i])));
+        }
+    }
+    XCTAssertLessThan(error, 2E-03, "Discretization error only");
+}
+
+- (void)testMultigridCyclesDoNotDependOnGrid {
+    size_t cycles[2];
+    const size_t sizes[2] = {33, 257};
+
+    for (size_t s = 0; s < 2; ++s) {
+        Vector<double> fine(sizes[s]);
+        for (size_t k = 0; k < fine.size(); ++k) {
+            fine[k] = k / double(fine.size() - 1);
+        }
+
+        Matrix<double> sol(fine.size(), fine.size(), 0);
+        PoissonSolver2D solver(equation, BCL_f | BCR_f | BCT_f | BCB_f, 0, fine, fine, false);
+        solver.dirichlet(sol);
+        cycles[s] = solver.multigrid(sol, 1E-10, 100);
+        XCTAssertLessThan(solver.residual(sol), 1E-10, "Converged");
+    }
+
+    XCTAssertLessThanOrEqual(cycles[1], cycles[0] + 2, "Same number of cycles on a 64 times larger grid");
+}
+
+- (void)testMultigridOddIntervals {
+    //  257 puntos se dividen a la mitad hasta el final; 250 y 251 llegan a un número impar de intervalos
+    const size_t sizes[3] = {257, 250, 251};
+    size_t cycles[3];
+
+    for (size_t s = 0; s < 3; ++s) {
+        Vector<double> fine(sizes[s]), other(sizes[s] - 7);
+        for (size_t k = 0; k < fine.size(); ++k) {
+            fine[k] = k / double(fine.size() - 1);
+        }
+        for (size_t k = 0; k < other.size(); ++k) {
+            other[k] = k / double(other.size() - 1);
+        }
+
+        Matrix<double> sol(other.size(), fine.size(), 0);
+        PoissonSolver2D solver(equation, BCL_f | BCR_f | BCT_f | BCB_df, 0, fine, other, true);
+        solver.dirichlet(sol);
+        cycles[s] = solver.multigrid(sol, 1E-10, 100);
+        XCTAssertLessThan(solver.residual(sol), 1E-10, "Converged");
+    }
+
+    XCTAssertLessThanOrEqual(cycles[1], cycles[0] + 2, "Coarse levels without nested grids");
+    XCTAssertLessThanOrEqual(cycles[2], cycles[0] + 2, "Coarse levels without nested grids");
+}
+
+- (void)testMultigridSameSolutionAsSOR {
+    const unsigned char bcs[] = {
+        BCL_f | BCR_f | BCT_f | BCB_f,
+        BCL_f | BCR_f | BCT_f | BCB_df,
+        BCL_df | BCR_f | BCT_f | BCB_f
+    };
+    equation.BCB = flux;
+
+    for (const unsigned char &bc : bcs) {
+        Matrix<double> cI(y.size(), x.size(), 0);
+        equation.method = SORmethod;
+        const Matrix<double> sor = equation.solvePOISSON(bc, 0, 0, x, y, cI, 1E-13, 200000);
+        equation.method = MGmethod;
+        const Matrix<double> mg = equation.solvePOISSON(bc, 0, 0, x, y, cI, 1E-13, 200);
+
+        double difference = 0;
+        for (size_t i = 0; i < y.size(); ++i) {
+            for (size_t j = 0; j < x.size(); ++j) {
+                difference = std::max(difference, std::abs(sor[i][j] - mg[i][j]));
+            }
+        }
+        XCTAssertLessThan(difference, 1E-08, "Multigrid converges to the SOR solution");
+    }
+}
+
+- (void)testFourierSameSolutionAsSOR {
+    //  Dirichlet en las dos direcciones, derivada en una de ellas y bordes sin condición (fijos)
+    const unsigned char bcs[] = {
+        BCL_f | BCR_f | BCT_f | BCB_f,
+        BCL_f | BCR_f | BCT_df | BCB_df,
+        BCL_df | BCR_df | BCT_f | BCB_f,
+        BCT_f
+    };
+    equation.BCB = flux;
+
+    for (const unsigned char &bc : bcs) {
+        Matrix<double> cI(y.size(), x.size(), 0.25);
+        equation.method = SORmethod;
+        const Matrix<double> sor = equation.solvePOISSON(bc, 0, 0, x, y, cI, 1E-12, 200000);
+        equation.method = FFTmethod;
+        const Matrix<double> fft = equation.solvePOISSON(bc, 0, 0, x, y, cI, 1E-12, 1);
+
+        double difference = 0;
+        for (size_t i = 0; i < y.size(); ++i) {
+            for (size_t j = 0; j < x.size(); ++j) {
+                difference = std::max(difference, std::abs(sor[i][j] - fft[i][j]));
+            }
+        }
+        XCTAssertLessThan(difference, 1E-09, "Same discrete solution without iterating");
+    }
+}
+
+- (void)testFourierResidual {
+    Matrix<double> sol(y.size(), x.size(), 0);
+    PoissonSolver2D solver(equation, BCL_f | BCR_f | BCT_f | BCB_f, 0, x, y, true);
+    solver.dirichlet(sol);
+    solver.fourier(sol);
+
+    XCTAssertLessThan(solver.residual(sol), 1E-13, "Exact discrete solution");
+}
+
+- (void)testFourierNeumann {
+    //  ∆u = cos(πx)·cos(πy) con derivada nula en los cuatro bordes: compatible, solución salvo una constante
+    equation.F = [](double x, double y) { return cos(M_PI * x) * cos(M_PI * y); };
+    equation.BCL = equation.BCR = equation.BCT = equation.BCB = zero;
+
+    Matrix<double> sol(y.size(), x.size(), 1.0);
+    PoissonSolver2D solver(equation, BCL_df | BCR_df | BCT_df | BCB_df, 0, x, y, true);
+    solver.fourier(sol);
+
+    XCTAssertLessThan(solver.residual(sol), 1E-13, "Derivative edges OK");
+    XCTAssertEqualWithAccuracy(sol[16][20], 1.0, 1E-12, "Constant taken from the initial solution");
+    XCTAssertEqualWithAccuracy(sol[0][0], -1.0 / (2.0 * M_PI * M_PI) + 1.0, 1E-03, "Continuous solution");
+}
+
+- (void)testFourierNotSeparable {
+    Matrix<double> sol(y.size(), x.size(), 0);
+    PoissonSolver2D mixed(equation, BCL_f | BCR_f | BCT_f | BCB_df, 0, x, y, true);
+    PoissonSolver2D special(equation, BCL_f | BCR_f | BCT_f | BCB_f, BCB_f, x, y, true);
+
+    XCTAssertFalse(mixed.separable(), "Derivative on only one edge");
+    XCTAssertFalse(special.separable(), "Special edge");
+    XCTAssertThrows(mixed.fourier(sol), "Not separable");
+
+    //  solvePOISSON no lanza: resuelve con sobrerrelajación
+    equation.BCB = flux;
+    Matrix<double> cI(y.size(), x.size(), 0);
+    equation.method = SORmethod;
+    const Matrix<double> sor = equation.solvePOISSON(BCL_f | BCR_f | BCT_f | BCB_df, 0, 0, x, y, cI, 1E-12, 200000);
+    equation.method = FFTmethod;
+    const Matrix<double> fft = equation.solvePOISSON(BCL_f | BCR_f | BCT_f | BCB_df, 0, 0, x, y, cI, 1E-12, 200000);
+    XCTAssertEqualWithAccuracy(fft[16][20], sor[16][20], 1E-14, "Falls back to SOR");
+}
+
+- (void)testConjugateGradient {
+    const PoissonSolver2D::Preconditioner preconditioners[] = {
+        PoissonSolver2D::none, PoissonSolver2D::jacobi, PoissonSolver2D::ssor, PoissonSolver2D::cholesky
+    };
+    PoissonSolver2D solver(equation, BCL_f | BCR_f | BCT_f | BCB_f, 0, x, y, true);
+
+    //  Solución inicial con todas las frecuencias, para que el precondicionador importe
+    Matrix<double> initial(y.size(), x.size(), 0);
+    for (size_t i = 0; i < y.size(); ++i) {
+        for (size_t j = 0; j < x.size(); ++j) {
+            initial[i][j] = sin(12.9898 * i + 78.233 * j);
+        }
+    }
+    solver.dirichlet(initial);
+
+    Matrix<double> exact = initial;
+    solver.fourier(exact);
+
+    size_t iterations[4];
+    for (size_t k = 0; k < 4; ++k) {
+        Matrix<double> sol = initial;
+
+        std::vector<double> residuals;
+        iterations[k] = solver.conjugateGradient(sol, 1E-12, 1000, preconditioners[k], 0, &residuals);
+        XCTAssertLessThan(iterations[k], 1000, "Conjugate gradient converges");
+        XCTAssertEqual(residuals.size(), iterations[k], "One residual per iteration");
+        XCTAssertEqualWithAccuracy(residuals.back(), solver.residual(sol), 1E-14, "Recursive residual is the true residual");
+
+        double difference = 0;
+        for (size_t i = 0; i < y.size(); ++i) {
+            for (size_t j = 0; j < x.size(); ++j) {
+                difference = std::max(difference, std::abs(sol[i][j] - exact[i][j]));
+            }
+        }
+        XCTAssertLessThan(difference, 1E-09, "Same discrete solution as the direct solver");
+    }
+
+    //  Con coeficientes constantes la diagonal es un múltiplo de la identidad: sólo cambia el redondeo
+    XCTAssertLessThanOrEqual(std::max(iterations[0], iterations[1]) - std::min(iterations[0], iterations[1]), 1, "Jacobi does not change the iterations");
+    XCTAssertLessThan(iterations[2] * 3, iterations[0] * 2, "SSOR needs fewer iterations");
+    XCTAssertLessThan(iterations[3] * 3, iterations[0] * 2, "Incomplete Cholesky needs fewer iterations");
+}
+
+- (void)testConjugateGradientMethods {
+    Matrix<double> cI(y.size(), x.size(), 0);
+    equation.method = FFTmethod;
+    const Matrix<double> fft = equation.solvePOISSON(BCL_f | BCR_f | BCT_f | BCB_f, 0, 0, x, y, cI, 1E-12, 1);
+
+    for (const unsigned char &method : {CGmethod, PCGJmethod, PCGSSORmethod, PCGICmethod}) {
+        equation.method = method;
+        const Matrix<double> cg = equation.solvePOISSON(BCL_f | BCR_f | BCT_f | BCB_f, 0, 0, x, y, cI, 1E-12, 1000);
+        XCTAssertEqualWithAccuracy(cg[16][20], fft[16][20], 1E-09, "Same solution");
+    }
+}
+
+- (void)testConjugateGradientNeedsFixedEdges {
+    Matrix<double> sol(y.size(), x.size(), 0);
+    PoissonSolver2D fixed(equation, BCL_f | BCR_f | BCT_f, 0, x, y, true);
+    PoissonSolver2D derivative(equation, BCL_f | BCR_f | BCT_f | BCB_df, 0, x, y, true);
+
+    XCTAssertTrue(fixed.symmetric(), "Edges without condition are fixed");
+    XCTAssertFalse(derivative.symmetric(), "Derivative edges are not symmetric");
+    XCTAssertThrows(derivative.conjugateGradient(sol, 1E-10, 100), "Not symmetric");
+
+    //  solvePOISSON no lanza: resuelve con sobrerrelajación
+    equation.BCB = flux;
+    Matrix<double> cI(y.size(), x.size(), 0);
+    equation.method = SORmethod;
+    const Matrix<double> sor = equation.solvePOISSON(BCL_f | BCR_f | BCT_f | BCB_df, 0, 0, x, y, cI, 1E-12, 200000);
+    equation.method = PCGICmethod;
+    const Matrix<double> cg = equation.solvePOISSON(BCL_f | BCR_f | BCT_f | BCB_df, 0, 0, x, y, cI, 1E-12, 200000);
+    XCTAssertEqualWithAccuracy(cg[16][20], sor[16][20], 1E-14, "Falls back to SOR");
+}
+
+- (void)testTooSmallGrid {
+    XCTAssertThrows(PoissonSolver2D(equation, 0, 0, Vector<double>(2), y, false), "At least 3 points per direction");
+}
+
+@end
@@ -0,0 +1,108 @@
+//
+//  StaticWaveSolver2DTests.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/differential_equations/WaveSolver2D.h"
+#import "../../../computational-physics/math/differential_equations/StaticWaveSolver2D.h"
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+static double unit_speed(double, double) {
+    return 1.0;
+}
+
+static double varying_speed(double x, double y) {
+    return 0.5 + x * y;
+}
+
+static double tilted(double x, double y) {
+    return 0.1 * x - 0.2 * y;
+}
+
+//  Mismo coeficiente que varying_speed, como funtor
+struct VaryingSpeed {
+    double operator()(double x, double y) const { return 0.5 + x * y; }
+};
+
+static EDP equation;
+static Vector<double> x, y;
+
+
+@interface StaticWaveSolver2DTests : XCTestCase
+
+@end
+
+@implementation StaticWaveSolver2DTests
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+
+    [TestsTools setWaveEquation:equation withSpeed:unit_speed];
+
+    //  Membrana unidad con 41x37 puntos
+    [TestsTools setUnitMembraneX:x columns:41 y:y rows:37];
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testUniformCoefficient {
+    Matrix<double> cI(y.size(), x.size(), 0);
+    const Matrix<double> cId(y.size(), x.size(), 0);
+    Matrix<bool> fixed(y.size(), x.size(), false);
+    cI[18][20] = 1.0;
+    cI[0][5] = 0.5;
+    fixed[10][10] = true;
+
+    WaveSolver2D runtime(equation, BCL_df | BCR_df | BCT_df | BCB_df, x, y, cI, cId, fixed);
+    StaticWaveSolver2D<BCL_df | BCR_df | BCT_df | BCB_df, wave::Constant> compiled(wave::Constant{1.0}, x, y, cI, cId, fixed, equation.dt);
+
+    runtime.step(50);
+    compiled.step(50);
+
+    XCTAssertEqual(compiled.dt(), runtime.dt(), "Same time step");
+    XCTAssertEqual(compiled.current(), runtime.current(), "Same solution as WaveSolver2D");
+    XCTAssertEqual(compiled.previous(), runtime.previous(), "Same previous state as WaveSolver2D");
+    XCTAssertEqual(compiled.time(), runtime.time(), "Same time");
+}
+
+- (void)testFunctors {
+    Matrix<double> cI(y.size(), x.size(), 0);
+    Matrix<double> cId(y.size(), x.size(), 0);
+    Matrix<bool> fixed(y.size(), x.size(), false);
+    cI[18][20] = 1.0;
+    cId[30][3] = -2.0;
+    fixed[0][0] = true;
+    fixed[36][7] = true;
+
+    equation.Q2D = varying_speed;
+    equation.BCL = equation.BCB = tilted;
+
+    //  Sin condición en el borde superior: queda fijo
+    WaveSolver2D runtime(equation, BCL_df | BCR_df | BCB_df, x, y, cI, cId, fixed);
+    StaticWaveSolver2D<BCL_df | BCR_df | BCB_df, VaryingSpeed, double (*)(double, double), wave::Zero, wave::Zero, double (*)(double, double)>
+    compiled(VaryingSpeed(), x, y, cI, cId, fixed, equation.dt, 0, tilted, wave::Zero(), wave::Zero(), tilted);
+
+    runtime.step();
+    compiled.step();
+    XCTAssertEqual(compiled.current(), runtime.current(), "Same first step as WaveSolver2D");
+
+    runtime.step(40);
+    compiled.step(40);
+    XCTAssertEqual(compiled.current(), runtime.current(), "Same solution as WaveSolver2D");
+    XCTAssertEqual(compiled.current()[0][20], cI[0][20], "Top boundary does not move");
+    XCTAssertNotEqual(compiled.current()[36][20], 0, "Bottom boundary moves");
+}
+
+@end
@@ -0,0 +1,162 @@
+//
+//  TemporalBlockingTests.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import <cmath>
+#import <thread>
+#import <vector>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/differential_equations/SolveEDP.h"
+#import "../../../computational-physics/math/differential_equations/TemporalBlocking.h"
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+static double conductivity(double x, double y) {
+    return 1.0 + 0.01 * x + 0.02 * y;
+}
+
+static double boundary(double x, double y) {
+    return 0.001 * x - 0.002 * y;
+}
+
+
+@interface TemporalBlockingTests : XCTestCase
+
+@end
+
+@implementation TemporalBlockingTests
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testRowsFollowDependencies {
+    //  Media de tres filas con dos mallas que rotan: cualquier orden incorrecto cambia el resultado
+    for (const size_t n : {3, 4, 7, 50, 301}) {
+        const size_t m = 5, steps = 37;
+
+        Matrix<double> expected(n, m);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < m; ++j) {
+                expected[i][j] = sin(0.3 * i + j);
+            }
+        }
+        Matrix<double> grid[] = {expected, expected};
+
+        for (size_t s = 0; s < steps; ++s) {
+            Matrix<double> next(expected);
+            for (size_t i = 1; i < n - 1; ++i) {
+                for (size_t j = 0; j < m; ++j) {
+                    next[i][j] = (expected[i-1][j] + 2.0 * expected[i][j] + expected[i+1][j]) / 4.0;
+                }
+            }
+            expected = next;
+        }
+
+        //  Filas de 1 KiB para que haya bloques de varios pasos y también varios bloques
+        blocking::advance(n, steps, 1024, n, 1, [&](const size_t &s, const size_t &i) {
+            const Matrix<double> &c = grid[s % 2];
+            Matrix<double> &sol = grid[(s + 1) % 2];
+            for (size_t j = 0; j < m; ++j) {
+                sol[i][j] = (i == 0 || i == n - 1) ? c[i][j] : (c[i-1][j] + 2.0 * c[i][j] + c[i+1][j]) / 4.0;
+            }
+        });
+
+        XCTAssertEqual(grid[steps % 2], expected, "Blocked steps equal step by step, %zu rows", n);
+    }
+}
+
+- (void)testHeatStepsAreEquivalent {
+    for (const unsigned char bc : {0, BCL_df | BCR_df | BCT_df | BCB_df, BCL_df | BCT_df}) {
+        const size_t n = 37, m = 41, steps = 25;
+        Vector<double> x(m), y(n);
+        for (size_t j = 0; j < m; ++j) {
+            x[j] = 2.0 * j;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            y[i] = 3.0 * i;
+        }
+
+        Matrix<double> cI(n, m);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < m; ++j) {
+                cI[i][j] = sin(0.3 * i) * cos(0.2 * j);
+            }
+        }
+
+        EDP once, several;
+        for (EDP *equation : {&once, &several}) {
+            equation->time = 0.0;
+            equation->dt = 0.5;
+            equation->Q2D = conductivity;
+            equation->BCT = equation->BCL = equation->BCR = equation->BCB = boundary;
+        }
+
+        Matrix<double> expected(cI);
+        for (size_t step = 0; step < steps; ++step) {
+            expected = several.solveHEAT(bc, CACHE_COEFFICIENTS, x, y, expected);
+        }
+
+        XCTAssertEqual(once.solveHEAT(bc, CACHE_COEFFICIENTS, x, y, cI, steps), expected, "solveHEAT with steps equals step by step");
+        XCTAssertEqual(once.time, several.time, "Time OK");
+    }
+}
+
+- (void)testBalancedBands {
+    //  La segunda mitad de las filas cuesta el triple
+    const size_t n = 120, count = 4;
+    const auto cost = [](const size_t &i) { return i < 60 ? 1 : 3; };
+    const std::vector<size_t> bounds = blocking::balance(n, count, cost);
+
+    XCTAssertEqual(bounds.size(), count + 1, "One band per thread");
+    XCTAssertEqual(bounds.front(), 0, "First band starts at row 0");
+    XCTAssertEqual(bounds.back(), n, "Last band ends at row n");
+    for (size_t k = 0; k < count; ++k) {
+        size_t total = 0;
+        for (size_t i = bounds[k]; i < bounds[k + 1]; ++i) {
+            total += cost(i);
+        }
+        XCTAssertEqualWithAccuracy(total, 60, 3, "Every band costs the same");
+    }
+    XCTAssertGreaterThan(bounds[1] - bounds[0], bounds[3] - bounds[2], "Cheaper rows give wider bands");
+
+    const std::vector<size_t> equal = blocking::balance(10, 3);
+    XCTAssert(equal == std::vector<size_t>({0, 3, 6, 10}), "Same cost gives the bands of Member::range()");
+
+    //  Filas muy caras al principio: cada banda sigue teniendo al menos 3 filas
+    const std::vector<size_t> narrow = blocking::balance(12, 4, [](const size_t &i) { return i == 0 ? 1000 : 1; });
+    XCTAssert(narrow == std::vector<size_t>({0, 3, 6, 9, 12}), "Bands have at least 3 rows");
+}
+
+- (void)testTouchFollowsAdvance {
+    //  Cada fila se escribe primero desde el hilo que la calcula en el primer paso
+    const size_t n = 300, members = 4;
+    std::vector<std::thread::id> touched(n), computed(n);
+
+    blocking::touch(n, members, [&](const size_t &lo, const size_t &hi) {
+        for (size_t i = lo; i < hi; ++i) {
+            touched[i] = std::this_thread::get_id();
+        }
+    });
+    blocking::advance(n, 1, 64, members, 1, [&](const size_t &s, const size_t &i) {
+        computed[i] = std::this_thread::get_id();
+    });
+
+    XCTAssert(touched == computed, "touch() and advance() give the same rows to each thread");
+}
+
+@end
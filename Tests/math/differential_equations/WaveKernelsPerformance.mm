@@ -0,0 +1,79 @@
+//
+//  WaveKernelsPerformance.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include <chrono>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/differential_equations/WaveKernels.h"
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+@interface WaveKernelsPerformance : XCTestCase
+
+@end
+
+@implementation WaveKernelsPerformance
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testPerformanceCellsPerSecond {
+    //  Un solo hilo: mide el núcleo de cada juego de instrucciones sobre una malla de 2000x2000
+    const size_t size = 2000, sweeps = 10;
+    const wave::Stencil stencil = {size, size, 1E-03, 1E-03, 1E-04};
+    const Matrix<double> current(size, size, 1), previous(size, size, 0.5);
+    Matrix<double> next(size, size, 0);
+    const Matrix<float> current_single(current), previous_single(previous);
+    Matrix<float> next_single(next);
+
+    static const char *names[] = {"scalar", "AVX2", "AVX-512"};
+
+    [self measureBlock:^{
+        for (int isa = wave::simd::SCALAR; isa <= wave::simd::supported(); ++isa) {
+            const wave::simd::Kernel<double> kernel = wave::simd::kernel<wave::Leapfrog, true>(wave::simd::Isa(isa));
+
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t sweep = 0; sweep < sweeps; ++sweep) {
+                for (size_t i = 1; i < size - 1; ++i) {
+                    const wave::simd::Row<double> row = {current[i-1], current[i], current[i+1], previous[i], nullptr, 1.0, next[i]};
+                    kernel(row, stencil);
+                }
+            }
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            const double cells = double(sweeps) * (size - 2) * (size - 2);
+            NSLog(@"Wave kernel %s: %.0f Mcells/s", names[isa], cells / elapsed.count() * 1E-06);
+
+            //  Mismo barrido en float
+            const wave::simd::Kernel<float> single = wave::simd::kernel<wave::Leapfrog, true, SinglePrecision>(wave::simd::Isa(isa));
+
+            const auto start_single = std::chrono::steady_clock::now();
+            for (size_t sweep = 0; sweep < sweeps; ++sweep) {
+                for (size_t i = 1; i < size - 1; ++i) {
+                    const wave::simd::Row<float> row = {current_single[i-1], current_single[i], current_single[i+1], previous_single[i], nullptr, 1.0f, next_single[i]};
+                    single(row, stencil);
+                }
+            }
+            const std::chrono::duration<double> elapsed_single = std::chrono::steady_clock::now() - start_single;
+
+            NSLog(@"Wave kernel %s, single precision: %.0f Mcells/s", names[isa], cells / elapsed_single.count() * 1E-06);
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,116 @@
+//
+//  WaveKernelsTests.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import <cmath>
+#import <cstring>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/differential_equations/WaveKernels.h"
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+//  Ejecuta el núcleo de isa en todas las filas interiores. Devuelve el número de filas que difieren en algún bit del escalar
+template <typename Scheme, bool Uniform, typename Precision = DoublePrecision, typename T>
+static size_t differences(const wave::simd::Isa &isa, const wave::Stencil &stencil,
+                          const Matrix<T> &current, const Matrix<T> &other, const Matrix<T> &q) {
+    const wave::simd::Kernel<T> scalar = wave::simd::kernel<Scheme, Uniform, Precision>(wave::simd::SCALAR);
+    const wave::simd::Kernel<T> vector = wave::simd::kernel<Scheme, Uniform, Precision>(isa);
+
+    Matrix<T> expected(stencil.n, stencil.m, 0), solution(stencil.n, stencil.m, 0);
+    size_t rows = 0;
+
+    for (size_t i = 1; i < stencil.n - 1; ++i) {
+        wave::simd::Row<T> row = {current[i-1], current[i], current[i+1], other[i], q[i], 0.75, expected[i]};
+        scalar(row, stencil);
+        row.sol = solution[i];
+        vector(row, stencil);
+
+        if (std::memcmp(expected[i] + 1, solution[i] + 1, (stencil.m - 2) * sizeof(T)) != 0) {
+            ++rows;
+        }
+    }
+
+    return rows;
+}
+
+
+@interface WaveKernelsTests : XCTestCase
+
+@end
+
+@implementation WaveKernelsTests
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testVectorKernelsMatchScalar {
+    const wave::simd::Isa supported = wave::simd::supported();
+    NSLog(@"Wave kernels: SIMD level %d", int(supported));
+
+    //  Anchos que no son múltiplo del vector para pasar también por el bucle de cola
+    for (const size_t m : {3, 4, 10, 13, 67}) {
+        const size_t n = 9;
+        const wave::Stencil stencil = {n, m, 0.025, 0.03, 1E-03};
+
+        Matrix<double> current(n, m), other(n, m), q(n, m);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < m; ++j) {
+                current[i][j] = sin(0.7 * i + 0.3 * j);
+                other[i][j] = cos(0.2 * i - 0.5 * j);
+                q[i][j] = 1.0 + 0.1 * i * j;
+            }
+        }
+
+        for (int isa = wave::simd::SCALAR; isa <= supported; ++isa) {
+            const wave::simd::Isa level = wave::simd::Isa(isa);
+            XCTAssertEqual((differences<wave::FirstStep, true>(level, stencil, current, other, q)), 0, "First step, uniform coefficient");
+            XCTAssertEqual((differences<wave::FirstStep, false>(level, stencil, current, other, q)), 0, "First step, sampled coefficient");
+            XCTAssertEqual((differences<wave::Leapfrog, true>(level, stencil, current, other, q)), 0, "Leapfrog, uniform coefficient");
+            XCTAssertEqual((differences<wave::Leapfrog, false>(level, stencil, current, other, q)), 0, "Leapfrog, sampled coefficient");
+        }
+    }
+}
+
+- (void)testSingleAndMixedPrecisionKernelsMatchScalar {
+    const wave::simd::Isa supported = wave::simd::supported();
+
+    //  En float caben 8 o 16 puntos por vector
+    for (const size_t m : {3, 9, 18, 21, 67}) {
+        const size_t n = 9;
+        const wave::Stencil stencil = {n, m, 0.025, 0.03, 1E-03};
+
+        Matrix<float> current(n, m), other(n, m), q(n, m);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < m; ++j) {
+                current[i][j] = sin(0.7 * i + 0.3 * j);
+                other[i][j] = cos(0.2 * i - 0.5 * j);
+                q[i][j] = 1.0 + 0.1 * i * j;
+            }
+        }
+
+        for (int isa = wave::simd::SCALAR; isa <= supported; ++isa) {
+            const wave::simd::Isa level = wave::simd::Isa(isa);
+            XCTAssertEqual((differences<wave::FirstStep, true, SinglePrecision>(level, stencil, current, other, q)), 0, "Single, first step, uniform coefficient");
+            XCTAssertEqual((differences<wave::Leapfrog, false, SinglePrecision>(level, stencil, current, other, q)), 0, "Single, leapfrog, sampled coefficient");
+            XCTAssertEqual((differences<wave::FirstStep, false, MixedPrecision>(level, stencil, current, other, q)), 0, "Mixed, first step, sampled coefficient");
+            XCTAssertEqual((differences<wave::Leapfrog, true, MixedPrecision>(level, stencil, current, other, q)), 0, "Mixed, leapfrog, uniform coefficient");
+        }
+    }
+}
+
+@end
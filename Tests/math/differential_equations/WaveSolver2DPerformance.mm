@@ -0,0 +1,71 @@
+//
+//  WaveSolver2DPerformance.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include <chrono>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/differential_equations/WaveSolver2D.h"
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+static double unit_speed(double, double) {
+    return 1.0;
+}
+
+
+@interface WaveSolver2DPerformance : XCTestCase
+
+@end
+
+@implementation WaveSolver2DPerformance
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testPerformanceFirstStepAgainstLaterSteps {
+    //  El primer paso lee también la velocidad inicial, pero no debe copiar ninguna malla
+    const size_t size = 2000, steps = 10;
+
+    EDP equation;
+    [TestsTools setWaveEquation:equation withSpeed:unit_speed];
+    equation.dt = 1E-04;
+
+    Vector<double> x, y;
+    [TestsTools setUnitMembraneX:x columns:size y:y rows:size];
+
+    const Matrix<double> cI(size, size, 0), cId(size, size, 1);
+    const Matrix<bool> fixed(size, size, false);
+
+    [self measureBlock:^{
+        WaveSolver2D solver(equation, BCL_df | BCR_df | BCT_df | BCB_df, x, y, cI, cId, fixed);
+
+        auto start = std::chrono::steady_clock::now();
+        solver.step();
+        const std::chrono::duration<double> first = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        solver.step(steps);
+        const std::chrono::duration<double> later = std::chrono::steady_clock::now() - start;
+
+        //  Sólo se informa: la proporción entre ambos tiempos depende de la máquina y de su carga
+        NSLog(@"Wave %zux%zu: first step %.2f ms, later steps %.2f ms (ratio %.2f)", size, size,
+              first.count() * 1E+03, later.count() / steps * 1E+03, first.count() / (later.count() / steps));
+    }];
+}
+
+@end
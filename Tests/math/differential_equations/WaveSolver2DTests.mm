@@ -0,0 +1,251 @@
+//
+//  WaveSolver2DTests.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import <cmath>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/differential_equations/WaveSolver2D.h"
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+static double unit_speed(double, double) {
+    return 1.0;
+}
+
+//  Como la tensión de main.cpp: una variable global que cambia entre llamadas
+static double tension = 1.0;
+
+static double global_speed(double, double) {
+    return tension;
+}
+
+static EDP equation;
+static Vector<double> x, y;
+
+
+@interface WaveSolver2DTests : XCTestCase
+
+@end
+
+@implementation WaveSolver2DTests
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+
+    [TestsTools setWaveEquation:equation withSpeed:unit_speed];
+
+    //  Membrana unidad con 41x41 puntos
+    [TestsTools setUnitMembraneX:x columns:41 y:y rows:41];
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testRestStaysAtRest {
+    const Matrix<double> zero(y.size(), x.size(), 0);
+    const Matrix<bool> fixed(y.size(), x.size(), false);
+    WaveSolver2D solver(equation, BCL_df | BCR_df | BCT_df | BCB_df, x, y, zero, zero, fixed);
+
+    solver.step(10);
+    XCTAssert(solver.current().is_null(), "Membrane at rest stays at rest");
+    XCTAssertEqual(solver.steps(), 10, "Steps OK");
+    XCTAssertEqualWithAccuracy(solver.time(), 10 * solver.dt(), 1E-12, "Time OK");
+}
+
+- (void)testStepsAreEquivalent {
+    Matrix<double> cI(y.size(), x.size(), 0);
+    const Matrix<double> cId(y.size(), x.size(), 0);
+    Matrix<bool> fixed(y.size(), x.size(), false);
+    cI[20][20] = 1.0;
+    cI[5][30] = -0.5;
+    fixed[10][10] = true;
+    fixed[0][7] = true;
+
+    WaveSolver2D once(equation, BCL_df | BCT_df, x, y, cI, cId, fixed);
+    WaveSolver2D several(equation, BCL_df | BCT_df, x, y, cI, cId, fixed);
+
+    once.step(25);
+    for (size_t step = 0; step < 25; ++step) {
+        several.step();
+    }
+
+    XCTAssertEqual(once.current(), several.current(), "step(n) equals n calls to step()");
+    XCTAssertEqual(once.previous(), several.previous(), "Previous state OK");
+    XCTAssertEqual(once.current()[10][10], 0, "Fixed points do not move");
+    XCTAssertEqual(once.current()[0][7], 0, "Fixed boundary points do not move");
+    XCTAssertNotEqual(once.current()[19][20], 0, "Wave propagates");
+}
+
+- (void)testObstacleIsSkipped {
+    //  Obstáculo más ancho que CDA_WAVE_SKIP: sus filas se calculan por tramos y con menos peso al repartirlas.
+    //  El resultado es el de calcular todos los puntos y volver a fijar los del obstáculo después de cada paso
+    Matrix<double> cI(y.size(), x.size(), 0);
+    const Matrix<double> cId(y.size(), x.size(), 0);
+    Matrix<bool> fixed(y.size(), x.size(), false), none(y.size(), x.size(), false);
+    cI[30][20] = 1.0;
+    for (size_t i = 5; i < 15; ++i) {
+        for (size_t j = 2; j < 39; ++j) {
+            fixed[i][j] = true;
+            cI[i][j] = 0.25;
+        }
+    }
+
+    WaveSolver2D skipped(equation, BCL_df | BCR_df | BCT_df | BCB_df, x, y, cI, cId, fixed);
+    WaveSolver2D computed(equation, BCL_df | BCR_df | BCT_df | BCB_df, x, y, cI, cId, none);
+    for (size_t step = 0; step < 40; ++step) {
+        skipped.step();
+        computed.step();
+        for (size_t i = 5; i < 15; ++i) {
+            for (size_t j = 2; j < 39; ++j) {
+                computed.current()[i][j] = 0.25;
+            }
+        }
+    }
+
+    XCTAssertEqual(skipped.current(), computed.current(), "Fixed runs are skipped without changing the result");
+    XCTAssertEqual(skipped.current()[10][20], 0.25, "Obstacle does not move");
+}
+
+- (void)testNormalMode {
+    //  Modo (1, 1) con bordes fijos: u(x, y, t) = sin(πx)·sin(πy)·cos(π·√2·t)
+    Matrix<double> cI(y.size(), x.size());
+    const Matrix<double> cId(y.size(), x.size(), 0);
+    const Matrix<bool> fixed(y.size(), x.size(), false);
+    for (size_t i = 0; i < y.size(); ++i) {
+        for (size_t j = 0; j < x.size(); ++j) {
+            cI[i][j] = sin(M_PI * x[j]) * sin(M_PI * y[i]);
+        }
+    }
+
+    WaveSolver2D solver(equation, 0, x, y, cI, cId, fixed);
+    solver.step(500);
+
+    const double expected = cos(M_PI * sqrt(2.0) * solver.time());
+    XCTAssertEqualWithAccuracy(solver.current()[20][20], expected, 1E-03, "Center of the membrane OK");
+    XCTAssertEqualWithAccuracy(solver.current()[10][30], expected * sin(M_PI / 4) * sin(3 * M_PI / 4), 1E-03, "Normal mode is kept");
+    XCTAssertEqual(solver.current()[0][20], 0, "Dirichlet boundaries do not move");
+}
+
+- (void)testSingleAndMixedPrecision {
+    //  Mismo modo normal que testNormalMode con las mallas en float
+    Matrix<double> cI(y.size(), x.size());
+    const Matrix<double> cId(y.size(), x.size(), 0);
+    const Matrix<bool> fixed(y.size(), x.size(), false);
+    for (size_t i = 0; i < y.size(); ++i) {
+        for (size_t j = 0; j < x.size(); ++j) {
+            cI[i][j] = sin(M_PI * x[j]) * sin(M_PI * y[i]);
+        }
+    }
+
+    WaveSolver2D reference(equation, 0, x, y, cI, cId, fixed);
+    BasicWaveSolver2D<SinglePrecision> single(equation, 0, x, y, cI, cId, fixed);
+    BasicWaveSolver2D<MixedPrecision> mixed(equation, 0, x, y, cI, cId, fixed);
+
+    reference.step(500);
+    single.step(500);
+    mixed.step(500);
+
+    XCTAssertEqual(single.time(), reference.time(), "Time is kept in double");
+    XCTAssertEqualWithAccuracy(single.current()[20][20], reference.current()[20][20], 5E-04, "Single precision OK");
+    XCTAssertEqualWithAccuracy(mixed.current()[20][20], reference.current()[20][20], 5E-05, "Mixed precision OK");
+    XCTAssertEqualWithAccuracy(single.current()[10][30], reference.current()[10][30], 5E-04, "Single precision OK");
+    XCTAssertEqual(single.current()[0][20], 0, "Dirichlet boundaries do not move");
+}
+
+- (void)testSteppingWithoutAllocations {
+    Matrix<double> cI(y.size(), x.size(), 0);
+    const Matrix<double> cId(y.size(), x.size(), 0);
+    const Matrix<bool> fixed(y.size(), x.size(), false);
+    cI[20][20] = 1.0;
+
+    WaveSolver2D solver(equation, BCL_df | BCR_df | BCT_df | BCB_df, x, y, cI, cId, fixed);
+
+    size_t allocations = cda::math::memory::allocation_count();
+    solver.step();
+    XCTAssertEqual(cda::math::memory::allocation_count(), allocations, "First step does not copy the grids");
+
+    allocations = cda::math::memory::allocation_count();
+    solver.step(100);
+
+    XCTAssertEqual(cda::math::memory::allocation_count(), allocations, "Stepping does not allocate");
+    XCTAssertEqual(solver.steps(), 101, "Steps OK");
+}
+
+- (void)testCoefficientsFollowGlobals {
+    Matrix<double> cI(y.size(), x.size(), 0), cId(y.size(), x.size(), 0);
+    Matrix<bool> fixed(y.size(), x.size(), false);
+    cI[20][20] = 1.0;
+
+    Matrix<double> results[3];
+    const unsigned char options[3] = {0, CACHE_COEFFICIENTS, 0};
+    for (size_t k = 0; k < 3; ++k) {
+        EDP edp;
+        [TestsTools setWaveEquation:edp withSpeed:global_speed];
+
+        //  La tercera no cambia la tensión
+        tension = 1.0;
+        Matrix<double> a = cI;
+        a = edp.solveWAVE(BCL_df, options[k], x, y, a, cId, fixed, 5);
+        tension = k < 2 ? 0.25 : 1.0;
+        results[k] = edp.solveWAVE(BCL_df, options[k], x, y, a, cId, fixed, 5);
+    }
+    tension = 1.0;
+
+    XCTAssertNotEqual(results[0], results[2], "Q2D is sampled again in every call");
+    XCTAssertEqual(results[1], results[2], "CACHE_COEFFICIENTS keeps the first samples");
+}
+
+- (void)testAdvanceInBatches {
+    Matrix<double> cI(y.size(), x.size(), 0), cId(y.size(), x.size(), 0);
+    Matrix<bool> fixed(y.size(), x.size(), false);
+    cI[20][20] = 1.0;
+    fixed[10][10] = true;
+
+    EDP stepped, batched;
+    [TestsTools setWaveEquation:stepped withSpeed:unit_speed];
+    [TestsTools setWaveEquation:batched withSpeed:unit_speed];
+    const unsigned char bc = BCL_df | BCR_df;
+
+    //  Pulso en el centro antes de cada uno de los 24 pasos
+    Matrix<double> a = cI;
+    for (size_t step = 0; step < 24; ++step) {
+        if (step % 5 == 0) {
+            a[20][20] += 0.1;
+        }
+        a = stepped.solveWAVE(bc, 0, x, y, a, cId, fixed);
+    }
+
+    size_t frames = 0, done = 0;
+    Matrix<double> b = cI;
+    b[20][20] += 0.1;
+    b = batched.advance(bc, 0, x, y, b, cId, fixed, 24, 1, [&](Matrix<double> &sol) {
+        ++frames;
+        if (++done % 5 == 0) {
+            sol[20][20] += 0.1;
+        }
+    });
+
+    XCTAssertEqual(frames, 24, "One frame per batch");
+    XCTAssertEqual(a, b, "Changes made by frame are used by the next batch");
+    XCTAssertEqual(stepped.time, batched.time, "Time OK");
+
+    frames = 0;
+    a = stepped.solveWAVE(bc, 0, x, y, a, cId, fixed, 25);
+    b = batched.advance(bc, 0, x, y, b, cId, fixed, 25, 10, [&](Matrix<double> &) { ++frames; });
+    XCTAssertEqual(frames, 3, "Last batch is shorter");
+    XCTAssertEqual(a, b, "advance(steps, every) equals steps calls to solveWAVE");
+    XCTAssertEqual(stepped.time, batched.time, "Time OK");
+}
+
+@end
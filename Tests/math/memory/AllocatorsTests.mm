@@ -0,0 +1,88 @@
+//
+//  AllocatorsTests.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import <cstdint>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/containers/matrix.hpp"
+
+using namespace cda::math::containers;
+using namespace cda::math::memory;
+
+
+@interface AllocatorsTests : XCTestCase
+
+@end
+
+@implementation AllocatorsTests
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testAlignment {
+    for (size_t size = 1; size < 100; size += 7) {
+        const Matrix<double> matrix(size, size + 1);
+        XCTAssertEqual(reinterpret_cast<std::uintptr_t>(matrix.begin()) % CDA_MEMORY_ALIGNMENT, 0, "Matrix is aligned");
+
+        const Vector<float> vector(size);
+        XCTAssertEqual(reinterpret_cast<std::uintptr_t>(vector.begin()) % CDA_MEMORY_ALIGNMENT, 0, "Vector is aligned");
+    }
+
+    Matrix<double, AlignedAllocator<double, 4096>> page_aligned(10, 10);
+    XCTAssertEqual(reinterpret_cast<std::uintptr_t>(page_aligned.begin()) % 4096, 0, "Custom alignment OK");
+
+    page_aligned.resize(200, 10);
+    XCTAssertEqual(reinterpret_cast<std::uintptr_t>(page_aligned.begin()) % 4096, 0, "Alignment is kept after resizing");
+}
+
+- (void)testResizeKeepsElements {
+    Vector<double> vector({1, 2, 3, 4, 5});
+    vector.resize(1000);
+    XCTAssertEqual(vector.get(0, 5), Vector<double>({1, 2, 3, 4, 5}), "Elements are kept when growing");
+    XCTAssert(vector.get(5).is_null(), "New elements are filled with zeros");
+
+    vector.resize(3);
+    XCTAssertEqual(vector, Vector<double>({1, 2, 3}), "Elements are kept when shrinking");
+
+    vector.clear();
+    XCTAssert(vector.is_empty(), "Vector is empty");
+}
+
+- (void)testHugePageAllocator {
+    const size_t rows = 1024;
+    Matrix<double, HugePageAllocator<double>> matrix(rows, rows, 1);
+    XCTAssertEqual(reinterpret_cast<std::uintptr_t>(matrix.begin()) % CDA_HUGE_PAGE_SIZE, 0, "Large blocks are aligned to huge pages");
+    XCTAssertEqual(matrix.sum_row(rows - 1), rows, "Huge page matrix OK");
+
+    const Matrix<double> copy(matrix);
+    XCTAssertEqual(copy.sum_column(0), rows, "Copy between allocators OK");
+
+    Matrix<double, HugePageAllocator<double>> small(3, 3);
+    small.identity();
+    XCTAssertEqual(small.determinant(), 1, "Small blocks fall back to aligned allocations");
+}
+
+- (void)testFirstTouchAllocator {
+    Vector<double, FirstTouchAllocator<double>> vector(1 << 20);
+    XCTAssert(vector.is_null(), "First touch zeroes the elements");
+    XCTAssertEqual(reinterpret_cast<std::uintptr_t>(vector.begin()) % CDA_MEMORY_ALIGNMENT, 0, "First touch keeps alignment");
+
+    vector.fill(2);
+    Vector<double, FirstTouchAllocator<double>> other(vector.size(), 3);
+    XCTAssertEqual(vector * other, 6.0 * vector.size(), "Arithmetic between first touch vectors OK");
+}
+
+@end
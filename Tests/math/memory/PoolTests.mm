@@ -0,0 +1,91 @@
+//
+//  PoolTests.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/containers/matrix.hpp"
+#import "../../../computational-physics/math/memory/pool.hpp"
+
+using namespace cda::math::containers;
+using namespace cda::math::memory;
+
+
+@interface PoolTests : XCTestCase
+
+@end
+
+@implementation PoolTests
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testAcquireAndRelease {
+    Pool<Matrix<double>> pool;
+
+    Matrix<double> matrix = pool.acquire(10, 20);
+    XCTAssertEqual(matrix.rows(), 10, "Rows OK");
+    XCTAssertEqual(matrix.columns(), 20, "Columns OK");
+    XCTAssertEqual(pool.allocations(), 1, "New matrix allocated");
+
+    const double *buffer = matrix.begin();
+    pool.release(std::move(matrix));
+    XCTAssertEqual(pool.size(), 1, "Matrix is idle");
+
+    const Matrix<double> other = pool.acquire(20, 10);
+    XCTAssertEqual(pool.allocations(), 2, "Dimensions must match");
+
+    const Matrix<double> same = pool.acquire(10, 20);
+    XCTAssertEqual(same.begin(), buffer, "Buffer is reused");
+    XCTAssertEqual(pool.allocations(), 2, "No new allocations");
+    XCTAssertEqual(pool.size(), 0, "No idle matrices");
+
+    pool.release(Matrix<double>());
+    XCTAssertEqual(pool.size(), 0, "Empty matrices are discarded");
+
+    Pool<Vector<float>> vectors;
+    vectors.release(vectors.acquire(100));
+    XCTAssertEqual(vectors.acquire(100).size(), 100, "Vector pool OK");
+    XCTAssertEqual(vectors.allocations(), 1, "Vector is reused");
+}
+
+- (void)testTimeLoopWithoutAllocations {
+    //  Same rotation as EDP::solveWAVE: new solution, current state and previous state
+    const size_t rows = 64, columns = 48;
+    Pool<Matrix<double>> pool;
+    Matrix<double> current(rows, columns, 1), previous;
+
+    size_t allocations = 0;
+    for (size_t step = 0; step < 100; ++step) {
+        if (step == 10) {
+            allocations = allocation_count();
+        }
+
+        Matrix<double> next = pool.acquire(rows, columns);
+        if (previous.is_empty()) {
+            next = current;
+        } else {
+            next = 2.0 * current - previous;
+        }
+
+        pool.release(std::move(previous));
+        previous = std::move(current);
+        current = std::move(next);
+    }
+
+    XCTAssertEqual(allocation_count(), allocations, "No allocations after warm-up");
+    XCTAssertEqual(pool.allocations(), 2, "Three buffers rotate");
+}
+
+@end
@@ -0,0 +1,201 @@
+//
+//  TeamTests.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import <algorithm>
+#import <atomic>
+#import <stdexcept>
+#import <thread>
+#import <vector>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/parallel/team.hpp"
+
+using namespace cda::math::parallel;
+
+
+@interface TeamTests : XCTestCase
+
+@end
+
+@implementation TeamTests
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testRunOnEveryMember {
+    Team team(4);
+    XCTAssertEqual(team.size(), 4, "Size OK");
+
+    std::vector<size_t> calls(team.size(), 0), counts(team.size(), 0);
+    for (int run = 0; run < 100; ++run) {
+        team.run([&](const Team::Member &member) {
+            counts[member.index()] = member.count();
+            ++calls[member.index()];
+        });
+    }
+    XCTAssertEqual(std::count(calls.begin(), calls.end(), 100), 4, "Every member runs every time");
+    XCTAssertEqual(std::count(counts.begin(), counts.end(), 4), 4, "Every member takes part");
+
+    std::atomic<size_t> members(0);
+    team.run([&](const Team::Member &member) {
+        ++members;
+    }, 2);
+    XCTAssertEqual(members.load(), 2, "Run limited to two members");
+}
+
+- (void)testForEachCoversRange {
+    Team team(3);
+    std::vector<int> visited(10007, 0);
+
+    team.for_each(0, visited.size(), [&](const size_t &from, const size_t &to) {
+        for (size_t i = from; i < to; ++i) {
+            ++visited[i];
+        }
+    }, 1);
+
+    XCTAssertEqual(std::count(visited.begin(), visited.end(), 1), visited.size(), "Every index visited once");
+}
+
+- (void)testBarrier {
+    //  Each step reads the values written by the other members in the previous one
+    Team team(4);
+    const size_t size = 64, steps = 200;
+    std::vector<size_t> a(size, 0), b(size, 0);
+
+    team.run([&](const Team::Member &member) {
+        size_t from, to;
+        member.range(0, size, from, to);
+        for (size_t step = 0; step < steps; ++step) {
+            const std::vector<size_t> &source = step % 2 ? b : a;
+            std::vector<size_t> &target = step % 2 ? a : b;
+            for (size_t i = from; i < to; ++i) {
+                target[i] = source[(i + 1) % size] + 1;
+            }
+            member.barrier();
+        }
+    });
+
+    XCTAssertEqual(std::count(a.begin(), a.end(), steps), size, "Steps are synchronised");
+}
+
+- (void)testSerialFallbacks {
+    Team serial(1);
+    size_t count = 0;
+    serial.for_each(0, 100, [&](const size_t &from, const size_t &to) {
+        count += to - from;
+    }, 1);
+    XCTAssertEqual(count, 100, "Team without threads runs serially");
+
+    Team team(3);
+    std::atomic<size_t> nested(0), serial_runs(0);
+    team.run([&](const Team::Member &member) {
+        team.run([&](const Team::Member &inner) {
+            inner.barrier();
+            ++nested;
+            if (inner.count() == 1) {
+                ++serial_runs;
+            }
+        });
+    });
+    XCTAssertEqual(nested.load(), 3, "Nested runs complete");
+    XCTAssertEqual(serial_runs.load(), 3, "Nested runs are serial");
+}
+
+- (void)testExceptionsArePropagated {
+    Team team(3);
+    XCTAssertThrows(team.run([](const Team::Member &member) {
+        if (member.index() == 2) {
+            throw std::logic_error("Last member failed");
+        }
+    }), "Exception thrown by a member reaches the caller");
+
+    size_t runs = 0;
+    team.run([&](const Team::Member &member) {
+        if (member.index() == 0) {
+            ++runs;
+        }
+    });
+    XCTAssertEqual(runs, 1, "Team is usable after an exception");
+}
+
+- (void)testPinning {
+    Team team(3, Affinity::compact);
+    std::vector<int> pinned(team.size(), 0);
+    team.run([&](const Team::Member &member) {
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        sched_getaffinity(0, sizeof(set), &set);
+        pinned[member.index()] = CPU_COUNT(&set) == 1;
+#else
+        pinned[member.index()] = 1;
+#endif
+    });
+    XCTAssertEqual(std::count(pinned.begin(), pinned.end(), 1), 3, "Every member runs on a single CPU");
+
+    Team::unpin();
+    Team spread(2, Affinity::spread);
+    size_t runs = 0;
+    spread.run([&](const Team::Member &member) {
+        if (member.index() == 0) {
+            ++runs;
+        }
+    });
+    XCTAssertEqual(runs, 1, "Spread team runs");
+    Team::unpin();
+}
+
+- (void)testPinningIsOptIn {
+    //  Team created by one thread and driven by another, like the background simulation
+    Team team(2, Affinity::compact);
+    Team::unpin();
+
+    bool unchanged = false, pinned = false;
+    std::thread caller([&] {
+#if defined(__linux__)
+        cpu_set_t before, after;
+        CPU_ZERO(&before);
+        CPU_ZERO(&after);
+        sched_getaffinity(0, sizeof(before), &before);
+        team.run([](const Team::Member &member) {
+        });
+        sched_getaffinity(0, sizeof(after), &after);
+        unchanged = CPU_EQUAL(&before, &after);
+
+        team.pin(Affinity::compact);
+        sched_getaffinity(0, sizeof(after), &after);
+        pinned = CPU_COUNT(&after) == 1;
+        Team::unpin();
+#else
+        unchanged = pinned = true;
+#endif
+    });
+    caller.join();
+    XCTAssertTrue(unchanged, "run() does not change the affinity of its caller");
+    XCTAssertTrue(pinned, "A thread calling pin() is pinned as member 0");
+}
+
+- (void)testPerformanceStepHandoff {
+    Team &team = Team::shared();
+    [self measureBlock:^{
+        for (NSInteger i = 0; i < 1E+04; ++i) {
+            team.run([](const Team::Member &member) {
+            });
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,83 @@
+//
+//  ThreadPoolTests.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include <atomic>
+#include <stdexcept>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/parallel/thread_pool.hpp"
+
+using namespace cda::math::parallel;
+
+
+@interface ThreadPoolTests : XCTestCase
+
+@end
+
+@implementation ThreadPoolTests
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testParallelForCoversRange {
+    ThreadPool pool(3);
+    std::vector<int> visited(10007, 0);
+    
+    pool.parallel_for(0, visited.size(), [&](const size_t &from, const size_t &to) {
+        for (size_t i = from; i < to; ++i) {
+            ++visited[i];
+        }
+    });
+    
+    XCTAssertEqual(std::count(visited.begin(), visited.end(), 1), visited.size(), "Every index visited once");
+}
+
+- (void)testNestedParallelFor {
+    ThreadPool pool(3);
+    std::atomic<size_t> count(0);
+    
+    pool.parallel_for(0, 64, [&](const size_t &from, const size_t &to) {
+        for (size_t i = from; i < to; ++i) {
+            pool.parallel_for(0, 1000, [&](const size_t &from, const size_t &to) {
+                count += to - from;
+            }, 10);
+        }
+    });
+    
+    XCTAssertEqual(count.load(), 64000, "Nested loops complete");
+}
+
+- (void)testSerialPool {
+    ThreadPool pool(0);
+    XCTAssertEqual(pool.concurrency(), 1, "Only the calling thread");
+    
+    size_t count = 0;
+    pool.parallel_for(0, 100, [&](const size_t &from, const size_t &to) {
+        count += to - from;
+    });
+    XCTAssertEqual(count, 100, "Serial pool runs the whole range");
+}
+
+- (void)testExceptionsArePropagated {
+    ThreadPool pool(3);
+    XCTAssertThrows(pool.parallel_for(0, 100, [](const size_t &from, const size_t &to) {
+        if (to == 100) {
+            throw std::logic_error("Last chunk failed");
+        }
+    }), "Exception thrown by a task reaches the caller");
+}
+
+@end
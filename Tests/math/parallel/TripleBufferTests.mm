@@ -0,0 +1,97 @@
+//
+//  TripleBufferTests.mm
+//  Tests
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import <algorithm>
+#import <thread>
+#import <vector>
+
+#import "../../TestsTools.h"
+#import "../../../computational-physics/math/parallel/triple_buffer.hpp"
+
+using namespace cda::math::parallel;
+
+
+@interface TripleBufferTests : XCTestCase
+
+@end
+
+@implementation TripleBufferTests
+
+- (void)setUp {
+    // Put setup code here. This method is called before the invocation of each test method in the class.
+    [TestsTools setDefaultWorkingDirectory];
+}
+
+- (void)tearDown {
+    // Put teardown code here. This method is called after the invocation of each test method in the class.
+}
+
+- (void)testLatestFrameWins {
+    TripleBuffer<int> buffer(-1);
+    XCTAssertFalse(buffer.update(), "Nothing published yet");
+    XCTAssertEqual(buffer.front(), -1, "Initial value OK");
+
+    buffer.back() = 1;
+    buffer.publish();
+    XCTAssertTrue(buffer.update(), "New frame");
+    XCTAssertEqual(buffer.front(), 1, "Published frame OK");
+    XCTAssertFalse(buffer.update(), "Each frame is taken once");
+    XCTAssertEqual(buffer.front(), 1, "Front does not change without new frames");
+
+    //  Dos fotogramas antes de leer: el primero se pierde
+    buffer.back() = 2;
+    buffer.publish();
+    buffer.back() = 3;
+    buffer.publish();
+    XCTAssertTrue(buffer.update(), "New frame");
+    XCTAssertEqual(buffer.front(), 3, "Latest frame wins");
+}
+
+- (void)testFramesAreNotCopied {
+    TripleBuffer<std::vector<int>> buffer(std::vector<int>(16, 0));
+    const int *data = buffer.back().data();
+
+    buffer.publish();
+    XCTAssertTrue(buffer.update(), "New frame");
+    XCTAssertEqual(buffer.front().data(), data, "Handoff swaps slots");
+}
+
+- (void)testConcurrentHandoff {
+    const size_t frames = 20000;
+    TripleBuffer<std::vector<size_t>> buffer(std::vector<size_t>(64, 0));
+
+    std::thread producer([&]() {
+        for (size_t frame = 1; frame <= frames; ++frame) {
+            std::fill(buffer.back().begin(), buffer.back().end(), frame);
+            buffer.publish();
+        }
+    });
+
+    size_t last = 0, torn = 0, backwards = 0;
+    while (last < frames) {
+        if (buffer.update()) {
+            const std::vector<size_t> &frame = buffer.front();
+            if (std::count(frame.begin(), frame.end(), frame[0]) != (long)frame.size()) {
+                ++torn;
+            }
+            if (frame[0] <= last) {
+                ++backwards;
+            }
+            last = frame[0];
+        }
+    }
+    producer.join();
+
+    XCTAssertEqual(torn, 0, "Frames are never read while they are written");
+    XCTAssertEqual(backwards, 0, "Frames arrive in order");
+    XCTAssertEqual(last, frames, "Last frame arrives");
+}
+
+@end
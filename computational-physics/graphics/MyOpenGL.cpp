@@ -8,6 +8,12 @@
 
 #include "MyOpenGL.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <stdexcept>
+#include <thread>
+
 #ifdef __APPLE__
 #include <OpenGL/OpenGL.h>
 #include <GLUT/glut.h>
@@ -23,17 +29,28 @@ OpenGL OpenGL_Plot;
 
 bool initOpenGL = false;
 bool defaultSettings = false;
-int plot_number = 1;
 int pKeys = 0;
 float dAng = 0.5, dPos = 0.1, dZoom = 0.01, zoom = 1.0;
 float eyeInitPosX = 1.0, eyeInitPosY = 1.0, eyeInitPosZ = 1.0;
 float eyePosX = 1.0, eyePosY = 1.0, eyePosZ = 1.0;
 
+std::thread simulation;
+std::atomic<bool> simulating(false);
+thread_local bool simulationThread = false;
+
 void upPlot()
 {
     
 }
 
+//  Los datos que lee la ventana sólo se cambian desde su hilo: el de la simulación usa OpenGL::publish
+static void checkWindowThread()
+{
+    if (simulationThread) {
+        throw std::logic_error("OpenGL::setData no puede llamarse desde updateData, que debe usar OpenGL::publish");
+    }
+}
+
 
 //  OPENGL - CLASS
 //  Init graphics::Plot
@@ -46,6 +63,7 @@ void OpenGL::initRendering()
 //  Set data
 void OpenGL::setData(const Vector<double> &x, const Vector<double> &y, unsigned char setDefault)
 {
+    checkWindowThread();
     OpenGL_Plot._vX = x;
     OpenGL_Plot._vY = y;
     
@@ -62,6 +80,7 @@ void OpenGL::setData(const Vector<double> &x, const Vector<double> &y)
 
 void OpenGL::setData(const Vector<double> &x, const Vector<double> &y, const Vector<double> &z, unsigned char setDefault)
 {
+    checkWindowThread();
     OpenGL_Plot._vX = x;
     OpenGL_Plot._vY = y;
     OpenGL_Plot._vZ = z;
@@ -79,6 +98,7 @@ void OpenGL::setData(const Vector<double> &x, const Vector<double> &y, const Vec
 
 void OpenGL::setData(const Vector<double> &x, const Vector<double> &y, const Matrix<double> &z, unsigned char setDefault)
 {
+    checkWindowThread();
     OpenGL_Plot._vX = x;
     OpenGL_Plot._vY = y;
     OpenGL_Plot._mZ = z;
@@ -94,6 +114,13 @@ void OpenGL::setData(const Vector<double> &x, const Vector<double> &y, const Mat
     setData(x, y, z, SetDefault);
 }
 
+void OpenGL::publish(const Matrix<double> &z)
+{
+    //  Copia en el buffer libre (sin reservar memoria si no cambia el tamaño) y lo intercambia con el publicado
+    OpenGL_Plot._frames.back() = z;
+    OpenGL_Plot._frames.publish();
+}
+
 
 //  Set ajustments
 void OpenGL::setColors(float red, float green, float blue)
@@ -163,6 +190,11 @@ void OpenGL::setStepTime(float dt_milli, unsigned char setDefault)
         OpenGL_Plot._plots_calc = (int)ceil(1/(dt_milli*1E4));
     }
     
+    //  Un fotograma agrupa los pasos de todos los intervalos de _dt que caben en FRAME_TIME
+    const int ticks = std::max(FRAME_TIME / OpenGL_Plot._dt, 1);
+    OpenGL_Plot._frame_dt = ticks * OpenGL_Plot._dt;
+    OpenGL_Plot._frame_steps = ticks * OpenGL_Plot._plots_calc;
+    
     if (!defaultSettings && (setDefault& SetDefault) != 0) {
         setDefaultParameters(Rot_D | Zoom_D | WN_D | WSize_D | Update_D);
         defaultSettings = true;
@@ -174,6 +206,11 @@ void OpenGL::setStepTime(float dt_milli)
     setStepTime(dt_milli, SetDefault);
 }
 
+int OpenGL::stepsPerFrame()
+{
+    return OpenGL_Plot._frame_steps;
+}
+
 void OpenGL::setWindowSize(float Width, float Height, unsigned char setDefault)
 {
     OpenGL_Plot._W = Width;
@@ -299,6 +336,40 @@ void OpenGL::refreshCameraPosition(int value)
 }
 
 
+void OpenGL::startSimulation()
+{
+    if (OpenGL_Plot._updateData == upPlot || simulating.exchange(true)) {
+        return;
+    }
+    
+    //  El primer fotograma se calcula aquí para que los estáticos que use _updateData ya estén construidos:
+    //  exit() desde la ventana los destruye después de stopSimulation, con el hilo ya parado
+    OpenGL_Plot._updateData();
+    std::atexit(stopSimulation);
+    
+    simulation = std::thread([]() {
+        simulationThread = true;
+        auto next = std::chrono::steady_clock::now();
+        while (simulating.load(std::memory_order_relaxed)) {
+            //  _updateData calcula todos los pasos del fotograma (stepsPerFrame) y lo publica
+            OpenGL_Plot._updateData();
+            
+            //  Si va con retraso no intenta recuperarlo: la simulación va más lenta
+            next = std::max(next + std::chrono::milliseconds(OpenGL_Plot._frame_dt.load()), std::chrono::steady_clock::now());
+            std::this_thread::sleep_until(next);
+        }
+    });
+}
+
+void OpenGL::stopSimulation()
+{
+    simulating = false;
+    if (simulation.joinable()) {
+        simulation.join();
+    }
+}
+
+
 //  2D functions
 void OpenGL::display2D()
 {
@@ -352,18 +423,15 @@ void OpenGL::drawSolution2D()
 
 void OpenGL::timerFunction2D(int value)
 {
-    OpenGL_Plot._updateData();
+    //  Último fotograma publicado por la simulación, si hay uno nuevo
+    if (OpenGL_Plot._frames.update()) {
+        OpenGL_Plot._mZ.swap(OpenGL_Plot._frames.front());
+    }
     
-    if (OpenGL_Plot._plots_calc > 1) {
-        if (plot_number%OpenGL_Plot._plots_calc == 0){
-            plot_number = (int)0;
-            OpenGL_Plot.display2D();
-        }
-    } else
-        OpenGL_Plot.display2D();
+    OpenGL_Plot.display2D();
     
     glutPostRedisplay();
-    glutTimerFunc(OpenGL_Plot._dt, timerFunction2D, 0);
+    glutTimerFunc(OpenGL_Plot._frame_dt, timerFunction2D, 0);
 }
 
 void OpenGL::plotAxes2D()
@@ -511,19 +579,14 @@ void OpenGL::drawSolution3D()
 
 void OpenGL::timerFunction3D(int value)
 {
-    OpenGL_Plot._updateData();
-    
-    if (OpenGL_Plot._plots_calc > 1) {
-        if (plot_number%OpenGL_Plot._plots_calc == 0){
-            plot_number = (int)0;
-            OpenGL_Plot.display3D();
-        }
-    } else
-        OpenGL_Plot.display3D();
+    //  Toma el último fotograma del hilo de la simulación, si hay uno nuevo, sin copiarlo
+    if (OpenGL_Plot._frames.update()) {
+        OpenGL_Plot._mZ.swap(OpenGL_Plot._frames.front());
+    }
+    OpenGL_Plot.display3D();
     
     glutPostRedisplay();
-    glutTimerFunc(OpenGL_Plot._dt, timerFunction3D, 1);
-    plot_number++;
+    glutTimerFunc(OpenGL_Plot._frame_dt, timerFunction3D, 1);
 }
 
 void OpenGL::plotAxes3D()
@@ -948,13 +1011,14 @@ void cda::graphics::plot(Vector<double> &x, Vector<double> &y, unsigned char opt
     glutCreateWindow((char *)OpenGL_Plot._windowName.c_str());
     OpenGL::initRendering();
     glutDisplayFunc(OpenGL::display2D);
-    glutTimerFunc(OpenGL_Plot._dt, OpenGL::timerFunction2D, 0);
+    glutTimerFunc(OpenGL_Plot._frame_dt, OpenGL::timerFunction2D, 0);
     glutTimerFunc(OpenGL_Plot._dt, OpenGL::refreshCameraPosition, 0);
     glutKeyboardFunc(OpenGL::handleKeyPress);
     glutKeyboardUpFunc(OpenGL::handleKeyRelease);
     glutSpecialFunc(OpenGL::handleSpecialKeyPress);
     glutSpecialUpFunc(OpenGL::handleSpecialKeyReleased);
     glutReshapeFunc(OpenGL::reshape2D);
+    OpenGL::startSimulation();
     glutMainLoop();
 }
 
@@ -970,13 +1034,14 @@ void cda::graphics::plot(Vector<double> &x, Vector<double> &y, Vector<double> &z
     glutCreateWindow((char *)OpenGL_Plot._windowName.c_str());
     OpenGL::initRendering();
     glutDisplayFunc(OpenGL::display3D);
-    glutTimerFunc(OpenGL_Plot._dt, OpenGL::timerFunction2D, 0);
+    glutTimerFunc(OpenGL_Plot._frame_dt, OpenGL::timerFunction2D, 0);
     glutTimerFunc(OpenGL_Plot._dt, OpenGL::refreshCameraPosition, 0);
     glutKeyboardFunc(OpenGL::handleKeyPress);
     glutKeyboardUpFunc(OpenGL::handleKeyRelease);
     glutSpecialFunc(OpenGL::handleSpecialKeyPress);
     glutSpecialUpFunc(OpenGL::handleSpecialKeyReleased);
     glutReshapeFunc(OpenGL::reshape3D);
+    OpenGL::startSimulation();
     glutMainLoop();
 }
 
@@ -992,12 +1057,13 @@ void cda::graphics::plot(const Vector<double> &x, const Vector<double> &y, const
     glutCreateWindow((char *)OpenGL_Plot._windowName.c_str());
     OpenGL::initRendering();
     glutDisplayFunc(OpenGL::display3D);
-    glutTimerFunc(OpenGL_Plot._dt, OpenGL::timerFunction3D, 1);
+    glutTimerFunc(OpenGL_Plot._frame_dt, OpenGL::timerFunction3D, 1);
     glutTimerFunc(OpenGL_Plot._dt, OpenGL::refreshCameraPosition, 2);
     glutKeyboardFunc(OpenGL::handleKeyPress);
     glutKeyboardUpFunc(OpenGL::handleKeyRelease);
     glutSpecialFunc(OpenGL::handleSpecialKeyPress);
     glutSpecialUpFunc(OpenGL::handleSpecialKeyReleased);
     glutReshapeFunc(OpenGL::reshape3D);
+    OpenGL::startSimulation();
     glutMainLoop();
 }
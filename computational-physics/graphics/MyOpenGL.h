@@ -8,10 +8,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 
 #include "../math/containers/vector.hpp"
 #include "../math/containers/matrix.hpp"
+#include "../math/parallel/triple_buffer.hpp"
 
 
 //  OPENGL
@@ -33,6 +35,9 @@ namespace cda {
 #define Update_D    0x20
 #define SetDefault  0x40
         
+        //  Tiempo mínimo entre dos fotogramas (ms). Cada fotograma calcula los pasos de todo ese tiempo
+#define FRAME_TIME  16
+        
         class OpenGL {
         private:
             float _rotX, _rotY, _rotZ;
@@ -45,20 +50,25 @@ namespace cda {
             math::containers::Vector<double> _vX, _vY, _vZ;
             math::containers::Matrix<double> _mZ;
             
+            //  Fotogramas que publica el hilo de la simulación. El de la ventana intercambia el último con _mZ
+            math::parallel::TripleBuffer<math::containers::Matrix<double>> _frames;
+            
             void (* _updateData)();
             
         public:
             //  Plot options
             unsigned char _options;
             std::string _windowName;
-            int _dt, _plots_calc;
+            //  Los cambia setStepTime desde el hilo de la simulación mientras los lee el de la ventana
+            std::atomic<int> _dt, _plots_calc;
+            std::atomic<int> _frame_dt, _frame_steps;   //  Milisegundos entre fotogramas y pasos que calcula cada uno
             float _W, _H;
             
             //  Init class
             static void initRendering();
             
             
-            //  Set params
+            //  Set params. Sólo desde el hilo de la ventana: desde updateData lanzan std::logic_error
             static void setData(const math::containers::Vector<double> &x, const math::containers::Vector<double> &y, unsigned char setDefault);
             static void setData(const math::containers::Vector<double> &x, const math::containers::Vector<double> &y);
             static void setData(const math::containers::Vector<double> &x, const math::containers::Vector<double> &y, const math::containers::Vector<double> &z);
@@ -66,6 +76,9 @@ namespace cda {
             static void setData(const math::containers::Vector<double> &x, const math::containers::Vector<double> &y, const math::containers::Matrix<double> &z);
             static void setData(const math::containers::Vector<double> &x, const math::containers::Vector<double> &y, const math::containers::Matrix<double> &z, unsigned char setDefault);
             
+            //  Publica un nuevo fotograma de z desde updateData. Nunca espera a que se pinte el anterior
+            static void publish(const math::containers::Matrix<double> &z);
+            
             //  Set adjustments
             static void setColors(float red, float green, float blue);
             
@@ -81,6 +94,10 @@ namespace cda {
             static void setWindowSize(float Width, float Height);
             static void setUpdateData(void updateData(), unsigned char setDefault);
             static void setUpdateData(void updateData());
+            
+            //  updateData se ejecuta en su propio hilo una vez por fotograma, sin bloquear la ventana
+            //  Pasos que debe calcular updateData en cada fotograma para mantener el ritmo de setStepTime
+            static int stepsPerFrame();
             static void setWindowName(std::string windowName, unsigned char setDefault);
             static void setWindowName(std::string windowName);
             
@@ -92,6 +109,10 @@ namespace cda {
             static void reshape3D(int Width, int Height);
             static void refreshCameraPosition(int value);
             
+            //  Hilo de la simulación: llama a updateData al ritmo de los fotogramas hasta que termina el programa
+            static void startSimulation();
+            static void stopSimulation();
+            
             //  -- 2D functions --
             static void display2D();
             static void drawSolution2D();
@@ -51,26 +51,30 @@ double BC(double x, double y);
 
 //  Actualización de OpenGL
 void calcSol();
+void applyForce(Matrix<double> &state);
 
 
 //  Función pulso y función sinusoidal
 Matrix<double> pick(int x, int y, int rangeX, int rangeY, double strenght);
-Matrix<double> sinusoidalForce(int x, int y, int rangeX, int rangeY, double strenght, double freq);
+void sinusoidalForce(Matrix<double> &force, int x, int y, int rangeX, int rangeY, double strenght, double freq);
 
 
 //  Variables compartidas
-Matrix<double> cI, cId, sinu;
+Matrix<double> cI, cId, sinu, force;
 Matrix<bool> fixedPoints;
 Vector<double> vX, vY;
 int sPosX, sPosY, sRangeX, sRangeY;
 double Ten, P, Lx, Ly, dt, freqSignal, sForce;
 double const PI = acos(-1.0);
-unsigned char BConditions;
+unsigned char BConditions, waveOptions = 0;
 EDP membrane;
 
 
 int main(int argc, const char * argv[])
 {
+    //  Con membrane.processes > 1 los rangos de solveWAVE ejecutan de nuevo este programa
+    EDP::runRankIfRequested();
+    
     std::cout << std::endl;
     std::cout << "   Computación Avanzada\n";
     std::cout << "   Carlos David Álvaro Yunta\n";
@@ -574,6 +578,9 @@ void single_slit_A()                        //  Una rendija de anchura pequeña
     //  CONDICIONES DE CONTORNO
     BConditions = BCT_df | BCB_df | BCL_df | BCR_df;
     
+    //  Sólo se visualiza: basta con precisión simple
+    waveOptions = SINGLE_PRECISION;
+    
     //  CONFIGURACIÓN DE LA RENDIJA
     int SlitCenterX = m/3;
     int SlitCenterY = n/2;
@@ -702,6 +709,9 @@ void double_slit()                          //  Doble rendija
     //  CONDICIONES DE CONTORNO
     BConditions = BCT_df | BCB_df | BCL_df | BCR_df;
     
+    //  Sólo se visualiza: basta con precisión simple
+    waveOptions = SINGLE_PRECISION;
+    
     //  CONFIGURACIÓN DE LAS RENDIJAS
     for (int i=0; i<n; i++) {
         fixedPoints[i][m/3-1] = true;
@@ -1026,22 +1036,33 @@ double BC(double x, double y)               //  Condición de contorno
 
 
 //  ACTUALIZACIÓN DE LA FUNCIÓN
+void applyForce(Matrix<double> &state)      //  Aplica la fuerza sinusoidal del paso siguiente
+{
+    sinusoidalForce(force, sPosX, sPosY, sRangeX, sRangeY, sForce, freqSignal);
+    state += force - sinu;                  //  Sustituye la fuerza anterior por la nueva en una sola pasada
+    std::swap(sinu, force);                 //  Intercambia los buffers, no reserva memoria
+}
+
 void calcSol()                              //  Calcula los nuevos valores de la membrana y los pinta
 {
+    const size_t steps = OpenGL::stepsPerFrame();   //  Todos los pasos del fotograma en una sola llamada
+    
     if (model == chladni || model == diffraction) {
-        cI -= sinu;
-        sinu = sinusoidalForce(sPosX, sPosY, sRangeX, sRangeY, sForce, freqSignal);
-        cI += sinu;
+        //  La fuerza cambia en cada paso: tandas de un paso y la fuerza del siguiente entre ellas
+        size_t left = steps;
+        applyForce(cI);
+        cI = membrane.advance(BConditions, waveOptions, vX, vY, cI, cId, fixedPoints, steps, 1,
+                              [&left](Matrix<double> &state) { if (--left > 0) applyForce(state); });
+    } else {
+        cI = membrane.solveWAVE(BConditions, waveOptions, vX, vY, cI, cId, fixedPoints, steps);
     }
     
-    cI = membrane.solveWave(BConditions, vX, vY, cI, cId, fixedPoints);
-    
     if (membrane.dt != dt) {
         OpenGL::setStepTime(membrane.dt);
         dt = membrane.dt;
     }
     
-    OpenGL::setData(vX, vY, cI, 0);
+    OpenGL::publish(cI);
 }
 
 
@@ -1059,9 +1080,10 @@ Matrix<double> pick(int x, int y, int rangeX, int rangeY, double strenght)
     return tmp;
 }
 
-Matrix<double> sinusoidalForce(int x, int y, int rangeX, int rangeY, double strenght, double freq)      //  Fuerza sinusoidal
+void sinusoidalForce(Matrix<double> &tmp, int x, int y, int rangeX, int rangeY, double strenght, double freq)      //  Fuerza sinusoidal
 {
-    Matrix<double> tmp = Matrix<double>::zero(cId.rows(), cId.columns());
+    tmp.resize(cId.rows(), cId.columns());  //  Sólo reserva memoria la primera vez
+    tmp.zero();
     for (int i=y-rangeY; i<=y+rangeY; i++) {
         for (int j=x-rangeX; j<=x+rangeX; j++) {
             if (i >= 0 && i < cId.rows() && j >= 0 && j < cId.columns()) {
@@ -1070,6 +1092,4 @@ Matrix<double> sinusoidalForce(int x, int y, int rangeX, int rangeY, double stre
             }
         }
     }
-    
-    return tmp;
 }
@@ -10,4 +10,5 @@
 
 #include "find.hpp"
 #include "eigenvalues/qr.hpp"
+#include "transforms/fft.hpp"
 #include "systems/linear.hpp"
@@ -24,17 +24,22 @@ namespace cda {
         namespace algorithms {
             namespace eigenvalues {
                 
-                template <template<typename T> class Matrix, typename ValueType = double,
+                template <template<typename...> class Matrix, typename ValueType = double,
                           class = typename std::enable_if<std::is_floating_point<ValueType>::value>::type>
                 class QR {
                 public:
                     
-                    QR(const Matrix<ValueType> &matrix,
+                    /**
+                     @param matrix Any square matrix expression: a Matrix, a MatrixView or an element-wise expression
+                     */
+                    template <typename Source,
+                              typename = typename std::enable_if<!std::is_base_of<QR, Source>::value>::type>
+                    QR(const Source &matrix,
                        const double &accuracy = CDA_QR_DEFAULT_ACCURACY,
                        const size_t &max_iterations = CDA_QR_DEFAULT_MAX_ITERATIONS) :
-                    original(matrix), rows(matrix.rows()),
+                    original(matrix), rows(original.rows()),
                     _max_iterations(max_iterations), _accuracy(accuracy) {
-                        if (!matrix.is_square()) {
+                        if (!original.is_square()) {
                             throw std::logic_error("Matrix must be square to compute its eigenvalues.");
                         }
                     }
@@ -95,7 +100,7 @@ namespace cda {
                                 }
                             }
                             
-                            _eigen_values = matrix.get_diagonal();
+                            _eigen_values = matrix.diagonal_view();
                         }
                         
                         return _eigen_values;
@@ -111,7 +116,9 @@ namespace cda {
                         Matrix<ValueType> inverse_matrix(rows, rows, 0);
                         inverse_matrix.set_diagonal(eigen_value * (_accuracy + 1.0));
                         
-                        inverse_matrix = (original - inverse_matrix).pow(-1);
+                        //  A - λ·(1 + accuracy)·I, evaluated element by element over the diagonal it reads. Its inverse comes next
+                        inverse_matrix = original - inverse_matrix;
+                        inverse_matrix = inverse_matrix.pow(-1);
                         
                         ValueType normalization_factor = 0.0;
                         ValueType old_normalization_factor, distance;
@@ -131,7 +138,7 @@ namespace cda {
                             }
                         }
                         
-                        _eigen_vectors.emplace(eigen_value, eigenVector.get_column_as_vector(0) / eigenVector[0][rows - 1]);
+                        _eigen_vectors.emplace(eigen_value, eigenVector.column_view(0) / eigenVector[0][rows - 1]);
                         
                         return _eigen_vectors[eigen_value];
                     }
@@ -156,71 +163,54 @@ namespace cda {
                     containers::Vector<ValueType> _eigen_values;
                     std::map<ValueType, containers::Vector<ValueType>> _eigen_vectors;
                     
+                    /**
+                     Householder QR decomposition.
+                     
+                     Reflections are applied in place to the trailing blocks of R and Q through
+                     views, instead of building and multiplying full n x n reflection matrices.
+                     */
                     void compute_qr_matrices(const Matrix<ValueType> &matrix) {
                         
-                        const auto I = Matrix<ValueType>::identity(rows);
+                        _r = matrix;
+                        _q = Matrix<ValueType>::identity(rows);
                         
-                        //  First column
-                        auto c = matrix.get_column_as_vector(0);
-                        auto vt = I.get_row_as_vector(0);
-                        vt *= signum(c[0]) * c.norm();
-                        vt += c;
+                        containers::Vector<ValueType> v;
+                        const size_t last_row = rows > 2 ? rows - 1 : 1;
                         
-                        _q = containers::transpose(vt) * vt;
-                        _q *= -2.0 / vt.square_norm();
-                        _q += I;
-                        
-                        _r = _q * matrix;
-                        for (auto it_r = _r.begin() + rows; it_r != _r.end(); it_r += rows) {
-                            *it_r = 0;
-                        }
-                        
-                        //  Other columns
-                        Matrix<ValueType> h, h__;
-                        const auto last_row = rows - 1;
-                        ValueType *it_r_column, *it_end_r_column;
-                        
-                        for (size_t row = 1; row < last_row; ++row) {
-                            c = _r.get_column_as_vector(row, row);
-                            
+                        for (size_t row = 0; row < last_row; ++row) {
+                            const auto c = _r.column_view(row, row);
                             if (c.is_null()) {
-                                h = I;
-                            } else {
-                                vt = I.get_row_as_vector(row, row);
-                                vt *= signum(c[0]) * c.norm();
-                                vt += c;
-                                
-                                h = containers::transpose(vt) * vt;
-                                h *= -2.0 / vt.square_norm();
-                                h += Matrix<ValueType>::identity(rows - row);
-                                
-                                h__ = I;
-                                h__.set_matrix(row, row, h);
-                                h = std::move(h__);
+                                continue;
                             }
                             
-                            _q = h * _q;
-                            _r = h * _r;
+                            v = c;
+                            v[0] += signum(c[0]) * containers::norm(c);
+                            const ValueType beta = 2.0 / v.square_norm();
                             
-                            it_r_column = _r[row];
-                            it_end_r_column = it_r_column + row;
-                            for ( ; it_r_column != it_end_r_column; ++it_r_column) {
-                                *it_r_column = 0;
-                            }
+                            reflect(_r.matrix_view(row, row), v, beta);
+                            reflect(_q.matrix_view(row, 0), v, beta);
                         }
                         
-                        _q = std::move(_q.transpose());
+                        _q = _q.transpose();
                         
                         for (size_t row = 1; row < rows; ++row) {
-                            it_r_column = _r[row];
-                            it_end_r_column = it_r_column + row;
-                            for ( ; it_r_column < it_end_r_column; ++it_r_column) {
-                                *it_r_column = 0;
-                            }
+                            _r.row_view(row).view(0, row).fill(0);
                         }
                         
                     }
                     
+                    //  block = (I - beta * v * vt) * block
+                    static void reflect(const containers::MatrixView<ValueType> &block,
+                                        const containers::Vector<ValueType> &v, const ValueType &beta) {
+                        containers::Vector<ValueType> w(block.columns(), 0);
+                        for (size_t row = 0; row < block.rows(); ++row) {
+                            w += block.row(row) * v[row];
+                        }
+                        for (size_t row = 0; row < block.rows(); ++row) {
+                            block.row(row) -= w * (beta * v[row]);
+                        }
+                    }
+                    
                 };
                 
             } /* namespace eigenvalues */
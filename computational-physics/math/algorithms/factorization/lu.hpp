@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <stdexcept>
+#include <type_traits>
 
 
 namespace cda {
@@ -16,14 +18,19 @@ namespace cda {
         namespace algorithms {
             namespace factorization {
                 
-                template <template<typename T> class Matrix, typename ValueType = double,
+                template <template<typename...> class Matrix, typename ValueType = double,
                           class = typename std::enable_if<std::is_floating_point<ValueType>::value>::type>
                 class LU {
                 public:
                     
-                    LU(const Matrix<ValueType> &matrix) :
-                    lu(matrix), rows(matrix.rows()), is_factorized(false), _is_degenerate(false) {
-                        if (!matrix.is_square()) {
+                    /**
+                     @param matrix Any square matrix expression: a Matrix, a MatrixView or an element-wise expression
+                     */
+                    template <typename Source,
+                              typename = typename std::enable_if<!std::is_base_of<LU, Source>::value>::type>
+                    LU(const Source &matrix) :
+                    lu(matrix), rows(lu.rows()), is_factorized(false), _is_degenerate(false) {
+                        if (!lu.is_square()) {
                             throw std::logic_error("LU matrix cannot be computed for a non-square matrix.");
                         }
                     }
@@ -44,37 +51,44 @@ namespace cda {
                         return _is_degenerate;
                     }
                     
-                    template <template<typename> class Vector>
-                    Vector<ValueType> solve_linear_system(const Vector<ValueType> &b_terms) {
+                    template <template<typename...> class Vector, typename... Arguments>
+                    Vector<ValueType, Arguments...> solve_linear_system(const Vector<ValueType, Arguments...> &b_terms) {
+                        Vector<ValueType, Arguments...> x(rows);
+                        solve_linear_system(b_terms, x);
+                        return x;
+                    }
+                    
+                    /**
+                     Solves the system writing the solution into \p x, which may be a vector or a view
+                     (e.g. a column of another matrix). \p b_terms and \p x may share their elements.
+                     */
+                    template <typename Terms, typename Solution>
+                    void solve_linear_system(const Terms &b_terms, Solution &&x) {
                         
-                        if (rows != b_terms.size()) {
+                        if (rows != b_terms.size() || rows != x.size()) {
                             throw std::logic_error("The number of rows of the LU matrix does not match the number of elements in the b terms vector.");
                         }
                         
                         factorize_lu();
                         
-                        Vector<ValueType> tmp(rows, 0), x(rows, 0);
-                        
                         ValueType sum;
                         for (size_t row = 0; row < rows; ++row) {
+                            const auto lu_row = lu[row];
                             sum = 0;
                             for (size_t column = 0; column < row; ++column) {
-                                sum += lu[row][column] * tmp[column];
+                                sum += lu_row[column] * x[column];
                             }
-                            tmp[row] = b_terms[row] - sum;
+                            x[row] = b_terms[row] - sum;
                         }
                         
-                        // Since matrix is square -> #rows == #columns
-                        const size_t last_row = rows - 1;
-                        for (ssize_t row = last_row; row >= 0; --row) {
+                        for (size_t row = rows; row-- > 0;) {
+                            const auto lu_row = lu[row];
                             sum = 0;
-                            for (ssize_t column = last_row; column >= 0; --column) {
-                                sum += lu[row][column] * x[column];
+                            for (size_t column = row + 1; column < rows; ++column) {
+                                sum += lu_row[column] * x[column];
                             }
-                            x[row] = (tmp[row] - sum) / lu[row][row];
+                            x[row] = (x[row] - sum) / lu_row[row];
                         }
-                        
-                        return x;
                     }
                     
                     Matrix<ValueType> inverse_matrix() {
@@ -88,14 +102,14 @@ namespace cda {
                         const auto I = Matrix<ValueType>::identity(rows);
                         
                         for (size_t k = 0; k < rows; ++k) {
-                            inverse.set_column(k, solve_linear_system(I.get_row_as_vector(k)));
+                            solve_linear_system(I.row_view(k), inverse.column_view(k));
                         }
                         
                         return inverse;
                     }
                     
-                    template<typename OtherType>
-                    static Matrix<ValueType> inverse_matrix(const Matrix<OtherType> &matrix) {
+                    template<typename Source>
+                    static Matrix<ValueType> inverse_matrix(const Source &matrix) {
                         return LU<Matrix, ValueType>(matrix).inverse_matrix();
                     }
                     
@@ -114,8 +128,8 @@ namespace cda {
                         return determinant;
                     }
                     
-                    template<typename OtherType>
-                    static ValueType determinant(const Matrix<OtherType> &matrix) {
+                    template<typename Source>
+                    static ValueType determinant(const Source &matrix) {
                          return LU<Matrix, ValueType>(matrix).determinant();
                     }
                     
@@ -185,8 +199,8 @@ namespace cda {
                     }
                     
                     void check_singularities() {
-                        auto diagonal = lu.get_diagonal();
-                        if (diagonal.find(0) == diagonal.end()) {
+                        const auto diagonal = lu.diagonal_view();
+                        if (std::find(diagonal.begin(), diagonal.end(), 0) == diagonal.end()) {
                             return;
                         }
                         
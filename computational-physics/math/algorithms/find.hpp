@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <cmath>
+#include <iterator>
+
 namespace cda {
     namespace math {
         namespace algorithms {
@@ -23,8 +26,8 @@ namespace cda {
                     return end;
                 }
                 
-                template <typename T>
-                T max_element(const T* const begin, const T* const end) {
+                template <class InputIt>
+                typename std::iterator_traits<InputIt>::value_type max_element(InputIt begin, const InputIt end) {
                     auto max_element = *begin;
                     for (auto it = std::next(begin); it != end; ++it) {
                         if (*it > max_element) {
@@ -34,9 +37,9 @@ namespace cda {
                     return max_element;
                 }
                 
-                template <typename T>
-                T abs_max_element(const T* const begin, const T* const end) {
-                    T abs_it, max_element = std::abs(*begin);
+                template <class InputIt>
+                typename std::iterator_traits<InputIt>::value_type abs_max_element(InputIt begin, const InputIt end) {
+                    typename std::iterator_traits<InputIt>::value_type abs_it, max_element = std::abs(*begin);
                     for (auto it = std::next(begin); it != end; ++it) {
                         if ((abs_it = std::abs(*it)) > max_element) {
                             max_element = abs_it;
@@ -45,8 +48,8 @@ namespace cda {
                     return max_element;
                 }
                 
-                template <typename T>
-                T abs_max_element_with_sign(const T* const begin, const T* const end) {
+                template <class InputIt>
+                typename std::iterator_traits<InputIt>::value_type abs_max_element_with_sign(InputIt begin, const InputIt end) {
                     auto max_element = *begin;
                     for (auto it = std::next(begin); it != end; ++it) {
                         if (std::abs(*it) > std::abs(max_element)) {
@@ -56,8 +59,8 @@ namespace cda {
                     return max_element;
                 }
                 
-                template <typename T>
-                T min_element(const T* const begin, const T* const end) {
+                template <class InputIt>
+                typename std::iterator_traits<InputIt>::value_type min_element(InputIt begin, const InputIt end) {
                     auto min_element = *begin;
                     for (auto it = std::next(begin); it != end; ++it) {
                         if (*it < min_element) {
@@ -67,9 +70,9 @@ namespace cda {
                     return min_element;
                 }
                 
-                template <typename T>
-                T abs_min_element(const T* const begin, const T* const end) {
-                    T abs_it, min_element = std::abs(*begin);
+                template <class InputIt>
+                typename std::iterator_traits<InputIt>::value_type abs_min_element(InputIt begin, const InputIt end) {
+                    typename std::iterator_traits<InputIt>::value_type abs_it, min_element = std::abs(*begin);
                     for (auto it = std::next(begin); it != end; ++it) {
                         if ((abs_it = std::abs(*it)) < min_element) {
                             min_element = abs_it;
@@ -78,8 +81,8 @@ namespace cda {
                     return min_element;
                 }
                 
-                template <typename T>
-                T abs_min_element_with_sign(const T* const begin, const T* const end) {
+                template <class InputIt>
+                typename std::iterator_traits<InputIt>::value_type abs_min_element_with_sign(InputIt begin, const InputIt end) {
                     auto min_element = *begin;
                     for (auto it = std::next(begin); it != end; ++it) {
                         if (std::abs(*it) < std::abs(min_element)) {
@@ -0,0 +1,454 @@
+//
+//  gemm.hpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "../../parallel/thread_pool.hpp"
+
+//  Vector micro-kernels are compiled with target attributes and chosen at run time, so they do not need -march
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CDA_GEMM_X86
+#include <immintrin.h>
+#endif
+
+
+//  Products below this number of multiply-adds skip packing and use a plain i-k-j loop
+#define CDA_GEMM_SMALL_PRODUCT 32768
+
+
+namespace cda {
+    namespace math {
+        namespace algorithms {
+            namespace products {
+
+                namespace kernel {
+
+                    /**
+                     Instruction sets with their own micro-kernel. The best one supported by the CPU
+                     is chosen at run time (instruction_set())
+                     */
+                    enum Isa { portable, avx2, avx512 };
+
+                    /**
+                     Register and cache blocking parameters.
+
+                     mr x nr is the tile of C kept in registers by the micro-kernel,
+                     kc x nr panels of B are meant to live in L1 and mc x kc blocks of A in L2.
+                     */
+                    template <typename T, Isa isa>
+                    struct Traits {
+                        static constexpr size_t mr = 4;
+                        static constexpr size_t nr = 4;
+                        static constexpr size_t mc = mr * 24;
+                        static constexpr size_t kc = 256;
+                        static constexpr size_t nc = 4096;
+                    };
+
+#ifdef CDA_GEMM_X86
+                    template <>
+                    struct Traits<double, avx512> {
+                        static constexpr size_t mr = 8;
+                        static constexpr size_t nr = 8;
+                        static constexpr size_t mc = mr * 12;
+                        static constexpr size_t kc = 256;
+                        static constexpr size_t nc = 4096;
+                    };
+
+                    template <>
+                    struct Traits<float, avx512> {
+                        static constexpr size_t mr = 8;
+                        static constexpr size_t nr = 16;
+                        static constexpr size_t mc = mr * 12;
+                        static constexpr size_t kc = 384;
+                        static constexpr size_t nc = 4096;
+                    };
+
+                    template <>
+                    struct Traits<double, avx2> {
+                        static constexpr size_t mr = 6;
+                        static constexpr size_t nr = 8;
+                        static constexpr size_t mc = mr * 12;
+                        static constexpr size_t kc = 256;
+                        static constexpr size_t nc = 4096;
+                    };
+
+                    template <>
+                    struct Traits<float, avx2> {
+                        static constexpr size_t mr = 6;
+                        static constexpr size_t nr = 16;
+                        static constexpr size_t mc = mr * 12;
+                        static constexpr size_t kc = 384;
+                        static constexpr size_t nc = 4096;
+                    };
+#endif
+
+                    /**
+                     Portable micro-kernel: C[mr x nr] += A_panel * B_panel
+
+                     @param kc Depth of the packed panels
+                     @param a Packed panel of A (kc columns of mr elements)
+                     @param b Packed panel of B (kc rows of nr elements)
+                     @param c Top-left element of the C tile
+                     @param ldc Leading dimension of C
+                     */
+                    template <typename T, Isa isa>
+                    struct MicroKernel {
+                        static void run(const size_t &kc, const T *a, const T *b, T *c, const size_t &ldc) {
+                            constexpr size_t mr = Traits<T, isa>::mr;
+                            constexpr size_t nr = Traits<T, isa>::nr;
+
+                            T accumulator[mr][nr] = {};
+                            for (size_t p = 0; p < kc; ++p, a += mr, b += nr) {
+                                for (size_t i = 0; i < mr; ++i) {
+                                    const T a_i = a[i];
+                                    for (size_t j = 0; j < nr; ++j) {
+                                        accumulator[i][j] += a_i * b[j];
+                                    }
+                                }
+                            }
+
+                            for (size_t i = 0; i < mr; ++i, c += ldc) {
+                                for (size_t j = 0; j < nr; ++j) {
+                                    c[j] += accumulator[i][j];
+                                }
+                            }
+                        }
+                    };
+
+#ifdef CDA_GEMM_X86
+                    template <>
+                    struct MicroKernel<double, avx512> {
+                        __attribute__((target("avx512f")))
+                        static void run(const size_t &kc, const double *a, const double *b, double *c, const size_t &ldc) {
+                            __m512d c0 = _mm512_setzero_pd(), c1 = _mm512_setzero_pd(), c2 = _mm512_setzero_pd(), c3 = _mm512_setzero_pd();
+                            __m512d c4 = _mm512_setzero_pd(), c5 = _mm512_setzero_pd(), c6 = _mm512_setzero_pd(), c7 = _mm512_setzero_pd();
+
+                            for (size_t p = 0; p < kc; ++p, a += 8, b += 8) {
+                                const __m512d b0 = _mm512_loadu_pd(b);
+                                c0 = _mm512_fmadd_pd(_mm512_set1_pd(a[0]), b0, c0);
+                                c1 = _mm512_fmadd_pd(_mm512_set1_pd(a[1]), b0, c1);
+                                c2 = _mm512_fmadd_pd(_mm512_set1_pd(a[2]), b0, c2);
+                                c3 = _mm512_fmadd_pd(_mm512_set1_pd(a[3]), b0, c3);
+                                c4 = _mm512_fmadd_pd(_mm512_set1_pd(a[4]), b0, c4);
+                                c5 = _mm512_fmadd_pd(_mm512_set1_pd(a[5]), b0, c5);
+                                c6 = _mm512_fmadd_pd(_mm512_set1_pd(a[6]), b0, c6);
+                                c7 = _mm512_fmadd_pd(_mm512_set1_pd(a[7]), b0, c7);
+                            }
+
+                            _mm512_storeu_pd(c, _mm512_add_pd(_mm512_loadu_pd(c), c0)); c += ldc;
+                            _mm512_storeu_pd(c, _mm512_add_pd(_mm512_loadu_pd(c), c1)); c += ldc;
+                            _mm512_storeu_pd(c, _mm512_add_pd(_mm512_loadu_pd(c), c2)); c += ldc;
+                            _mm512_storeu_pd(c, _mm512_add_pd(_mm512_loadu_pd(c), c3)); c += ldc;
+                            _mm512_storeu_pd(c, _mm512_add_pd(_mm512_loadu_pd(c), c4)); c += ldc;
+                            _mm512_storeu_pd(c, _mm512_add_pd(_mm512_loadu_pd(c), c5)); c += ldc;
+                            _mm512_storeu_pd(c, _mm512_add_pd(_mm512_loadu_pd(c), c6)); c += ldc;
+                            _mm512_storeu_pd(c, _mm512_add_pd(_mm512_loadu_pd(c), c7));
+                        }
+                    };
+
+                    template <>
+                    struct MicroKernel<float, avx512> {
+                        __attribute__((target("avx512f")))
+                        static void run(const size_t &kc, const float *a, const float *b, float *c, const size_t &ldc) {
+                            __m512 c0 = _mm512_setzero_ps(), c1 = _mm512_setzero_ps(), c2 = _mm512_setzero_ps(), c3 = _mm512_setzero_ps();
+                            __m512 c4 = _mm512_setzero_ps(), c5 = _mm512_setzero_ps(), c6 = _mm512_setzero_ps(), c7 = _mm512_setzero_ps();
+
+                            for (size_t p = 0; p < kc; ++p, a += 8, b += 16) {
+                                const __m512 b0 = _mm512_loadu_ps(b);
+                                c0 = _mm512_fmadd_ps(_mm512_set1_ps(a[0]), b0, c0);
+                                c1 = _mm512_fmadd_ps(_mm512_set1_ps(a[1]), b0, c1);
+                                c2 = _mm512_fmadd_ps(_mm512_set1_ps(a[2]), b0, c2);
+                                c3 = _mm512_fmadd_ps(_mm512_set1_ps(a[3]), b0, c3);
+                                c4 = _mm512_fmadd_ps(_mm512_set1_ps(a[4]), b0, c4);
+                                c5 = _mm512_fmadd_ps(_mm512_set1_ps(a[5]), b0, c5);
+                                c6 = _mm512_fmadd_ps(_mm512_set1_ps(a[6]), b0, c6);
+                                c7 = _mm512_fmadd_ps(_mm512_set1_ps(a[7]), b0, c7);
+                            }
+
+                            _mm512_storeu_ps(c, _mm512_add_ps(_mm512_loadu_ps(c), c0)); c += ldc;
+                            _mm512_storeu_ps(c, _mm512_add_ps(_mm512_loadu_ps(c), c1)); c += ldc;
+                            _mm512_storeu_ps(c, _mm512_add_ps(_mm512_loadu_ps(c), c2)); c += ldc;
+                            _mm512_storeu_ps(c, _mm512_add_ps(_mm512_loadu_ps(c), c3)); c += ldc;
+                            _mm512_storeu_ps(c, _mm512_add_ps(_mm512_loadu_ps(c), c4)); c += ldc;
+                            _mm512_storeu_ps(c, _mm512_add_ps(_mm512_loadu_ps(c), c5)); c += ldc;
+                            _mm512_storeu_ps(c, _mm512_add_ps(_mm512_loadu_ps(c), c6)); c += ldc;
+                            _mm512_storeu_ps(c, _mm512_add_ps(_mm512_loadu_ps(c), c7));
+                        }
+                    };
+
+                    template <>
+                    struct MicroKernel<double, avx2> {
+                        __attribute__((target("avx2,fma")))
+                        static void run(const size_t &kc, const double *a, const double *b, double *c, const size_t &ldc) {
+                            __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd(), c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+                            __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd(), c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+                            __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd(), c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+                            __m256d a_i;
+
+                            for (size_t p = 0; p < kc; ++p, a += 6, b += 8) {
+                                const __m256d b0 = _mm256_loadu_pd(b);
+                                const __m256d b1 = _mm256_loadu_pd(b + 4);
+                                a_i = _mm256_broadcast_sd(a);     c00 = _mm256_fmadd_pd(a_i, b0, c00); c01 = _mm256_fmadd_pd(a_i, b1, c01);
+                                a_i = _mm256_broadcast_sd(a + 1); c10 = _mm256_fmadd_pd(a_i, b0, c10); c11 = _mm256_fmadd_pd(a_i, b1, c11);
+                                a_i = _mm256_broadcast_sd(a + 2); c20 = _mm256_fmadd_pd(a_i, b0, c20); c21 = _mm256_fmadd_pd(a_i, b1, c21);
+                                a_i = _mm256_broadcast_sd(a + 3); c30 = _mm256_fmadd_pd(a_i, b0, c30); c31 = _mm256_fmadd_pd(a_i, b1, c31);
+                                a_i = _mm256_broadcast_sd(a + 4); c40 = _mm256_fmadd_pd(a_i, b0, c40); c41 = _mm256_fmadd_pd(a_i, b1, c41);
+                                a_i = _mm256_broadcast_sd(a + 5); c50 = _mm256_fmadd_pd(a_i, b0, c50); c51 = _mm256_fmadd_pd(a_i, b1, c51);
+                            }
+
+                            _mm256_storeu_pd(c, _mm256_add_pd(_mm256_loadu_pd(c), c00)); _mm256_storeu_pd(c + 4, _mm256_add_pd(_mm256_loadu_pd(c + 4), c01)); c += ldc;
+                            _mm256_storeu_pd(c, _mm256_add_pd(_mm256_loadu_pd(c), c10)); _mm256_storeu_pd(c + 4, _mm256_add_pd(_mm256_loadu_pd(c + 4), c11)); c += ldc;
+                            _mm256_storeu_pd(c, _mm256_add_pd(_mm256_loadu_pd(c), c20)); _mm256_storeu_pd(c + 4, _mm256_add_pd(_mm256_loadu_pd(c + 4), c21)); c += ldc;
+                            _mm256_storeu_pd(c, _mm256_add_pd(_mm256_loadu_pd(c), c30)); _mm256_storeu_pd(c + 4, _mm256_add_pd(_mm256_loadu_pd(c + 4), c31)); c += ldc;
+                            _mm256_storeu_pd(c, _mm256_add_pd(_mm256_loadu_pd(c), c40)); _mm256_storeu_pd(c + 4, _mm256_add_pd(_mm256_loadu_pd(c + 4), c41)); c += ldc;
+                            _mm256_storeu_pd(c, _mm256_add_pd(_mm256_loadu_pd(c), c50)); _mm256_storeu_pd(c + 4, _mm256_add_pd(_mm256_loadu_pd(c + 4), c51));
+                        }
+                    };
+
+                    template <>
+                    struct MicroKernel<float, avx2> {
+                        __attribute__((target("avx2,fma")))
+                        static void run(const size_t &kc, const float *a, const float *b, float *c, const size_t &ldc) {
+                            __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps(), c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+                            __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps(), c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+                            __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps(), c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+                            __m256 a_i;
+
+                            for (size_t p = 0; p < kc; ++p, a += 6, b += 16) {
+                                const __m256 b0 = _mm256_loadu_ps(b);
+                                const __m256 b1 = _mm256_loadu_ps(b + 8);
+                                a_i = _mm256_broadcast_ss(a);     c00 = _mm256_fmadd_ps(a_i, b0, c00); c01 = _mm256_fmadd_ps(a_i, b1, c01);
+                                a_i = _mm256_broadcast_ss(a + 1); c10 = _mm256_fmadd_ps(a_i, b0, c10); c11 = _mm256_fmadd_ps(a_i, b1, c11);
+                                a_i = _mm256_broadcast_ss(a + 2); c20 = _mm256_fmadd_ps(a_i, b0, c20); c21 = _mm256_fmadd_ps(a_i, b1, c21);
+                                a_i = _mm256_broadcast_ss(a + 3); c30 = _mm256_fmadd_ps(a_i, b0, c30); c31 = _mm256_fmadd_ps(a_i, b1, c31);
+                                a_i = _mm256_broadcast_ss(a + 4); c40 = _mm256_fmadd_ps(a_i, b0, c40); c41 = _mm256_fmadd_ps(a_i, b1, c41);
+                                a_i = _mm256_broadcast_ss(a + 5); c50 = _mm256_fmadd_ps(a_i, b0, c50); c51 = _mm256_fmadd_ps(a_i, b1, c51);
+                            }
+
+                            _mm256_storeu_ps(c, _mm256_add_ps(_mm256_loadu_ps(c), c00)); _mm256_storeu_ps(c + 8, _mm256_add_ps(_mm256_loadu_ps(c + 8), c01)); c += ldc;
+                            _mm256_storeu_ps(c, _mm256_add_ps(_mm256_loadu_ps(c), c10)); _mm256_storeu_ps(c + 8, _mm256_add_ps(_mm256_loadu_ps(c + 8), c11)); c += ldc;
+                            _mm256_storeu_ps(c, _mm256_add_ps(_mm256_loadu_ps(c), c20)); _mm256_storeu_ps(c + 8, _mm256_add_ps(_mm256_loadu_ps(c + 8), c21)); c += ldc;
+                            _mm256_storeu_ps(c, _mm256_add_ps(_mm256_loadu_ps(c), c30)); _mm256_storeu_ps(c + 8, _mm256_add_ps(_mm256_loadu_ps(c + 8), c31)); c += ldc;
+                            _mm256_storeu_ps(c, _mm256_add_ps(_mm256_loadu_ps(c), c40)); _mm256_storeu_ps(c + 8, _mm256_add_ps(_mm256_loadu_ps(c + 8), c41)); c += ldc;
+                            _mm256_storeu_ps(c, _mm256_add_ps(_mm256_loadu_ps(c), c50)); _mm256_storeu_ps(c + 8, _mm256_add_ps(_mm256_loadu_ps(c + 8), c51));
+                        }
+                    };
+#endif
+
+                    /**
+                     Packs a block of A into row panels of mr elements, zero padding the last panel
+                     */
+                    template <typename T, Isa isa>
+                    void pack_a(const size_t &mc, const size_t &kc, const T *a, const size_t &lda, T *buffer) {
+                        constexpr size_t mr = Traits<T, isa>::mr;
+
+                        for (size_t panel = 0; panel < mc; panel += mr) {
+                            const size_t rows = std::min(mr, mc - panel);
+                            const T *a_panel = a + panel * lda;
+                            for (size_t p = 0; p < kc; ++p) {
+                                size_t i = 0;
+                                for (; i < rows; ++i) {
+                                    *buffer++ = a_panel[i * lda + p];
+                                }
+                                for (; i < mr; ++i) {
+                                    *buffer++ = static_cast<T>(0);
+                                }
+                            }
+                        }
+                    }
+
+                    /**
+                     Packs a block of B into column panels of nr elements, zero padding the last panel
+                     */
+                    template <typename T, Isa isa>
+                    void pack_b(const size_t &kc, const size_t &nc, const T *b, const size_t &ldb, T *buffer) {
+                        constexpr size_t nr = Traits<T, isa>::nr;
+
+                        for (size_t panel = 0; panel < nc; panel += nr) {
+                            const size_t columns = std::min(nr, nc - panel);
+                            const T *b_panel = b + panel;
+                            for (size_t p = 0; p < kc; ++p, b_panel += ldb) {
+                                size_t j = 0;
+                                for (; j < columns; ++j) {
+                                    *buffer++ = b_panel[j];
+                                }
+                                for (; j < nr; ++j) {
+                                    *buffer++ = static_cast<T>(0);
+                                }
+                            }
+                        }
+                    }
+
+                    /**
+                     Multiplies a packed mc x kc block of A by a packed kc x nc block of B, accumulating into C
+                     */
+                    template <typename T, Isa isa>
+                    void macro_kernel(const size_t &mc, const size_t &nc, const size_t &kc,
+                                      const T *a_packed, const T *b_packed, T *c, const size_t &ldc) {
+                        constexpr size_t mr = Traits<T, isa>::mr;
+                        constexpr size_t nr = Traits<T, isa>::nr;
+
+                        T edge[mr * nr];
+
+                        for (size_t jr = 0; jr < nc; jr += nr) {
+                            const size_t columns = std::min(nr, nc - jr);
+                            const T *b_panel = b_packed + jr * kc;
+
+                            for (size_t ir = 0; ir < mc; ir += mr) {
+                                const size_t rows = std::min(mr, mc - ir);
+                                const T *a_panel = a_packed + ir * kc;
+                                T *c_tile = c + ir * ldc + jr;
+
+                                if (rows == mr && columns == nr) {
+                                    MicroKernel<T, isa>::run(kc, a_panel, b_panel, c_tile, ldc);
+                                } else {
+                                    std::fill_n(edge, mr * nr, static_cast<T>(0));
+                                    MicroKernel<T, isa>::run(kc, a_panel, b_panel, edge, nr);
+                                    for (size_t i = 0; i < rows; ++i) {
+                                        for (size_t j = 0; j < columns; ++j) {
+                                            c_tile[i * ldc + j] += edge[i * nr + j];
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    /**
+                     Packed product of gemm() with the micro-kernel of \p isa
+                     */
+                    template <typename T, Isa isa>
+                    void blocked(const size_t &m, const size_t &n, const size_t &k,
+                                 const T *a, const size_t &lda,
+                                 const T *b, const size_t &ldb,
+                                 T *c, const size_t &ldc) {
+                        typedef Traits<T, isa> traits;
+
+                        //  The packed block of B is shared by all threads, blocks of A are packed per thread
+                        std::vector<T> b_buffer(traits::kc * ((std::min(traits::nc, n) + traits::nr - 1) / traits::nr) * traits::nr);
+                        const size_t m_blocks = (m + traits::mc - 1) / traits::mc;
+
+                        for (size_t jc = 0; jc < n; jc += traits::nc) {
+                            const size_t nc = std::min(traits::nc, n - jc);
+
+                            for (size_t pc = 0; pc < k; pc += traits::kc) {
+                                const size_t kc = std::min(traits::kc, k - pc);
+                                pack_b<T, isa>(kc, nc, b + pc * ldb + jc, ldb, b_buffer.data());
+
+                                parallel::parallel_for(0, m_blocks, [&](const size_t &from, const size_t &to) {
+                                    thread_local std::vector<T> a_buffer;
+                                    a_buffer.resize(traits::mc * traits::kc);
+
+                                    for (size_t ic = from * traits::mc; ic < std::min(m, to * traits::mc); ic += traits::mc) {
+                                        const size_t mc = std::min(traits::mc, m - ic);
+                                        pack_a<T, isa>(mc, kc, a + ic * lda + pc, lda, a_buffer.data());
+                                        macro_kernel<T, isa>(mc, nc, kc, a_buffer.data(), b_buffer.data(), c + ic * ldc + jc, ldc);
+                                    }
+                                }, 1);
+                            }
+                        }
+                    }
+
+                    inline Isa detect() {
+                        Isa isa = portable;
+
+#ifdef CDA_GEMM_X86
+                        __builtin_cpu_init();
+                        if (__builtin_cpu_supports("avx512f")) {
+                            isa = avx512;
+                        } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+                            isa = avx2;
+                        }
+#endif
+
+                        //  CDA_GEMM_SIMD=portable or avx2 limits the choice, e.g. to compare kernels
+                        if (const char *limit = std::getenv("CDA_GEMM_SIMD")) {
+                            if (std::strcmp(limit, "portable") == 0) {
+                                isa = portable;
+                            } else if (std::strcmp(limit, "avx2") == 0) {
+                                isa = std::min(isa, avx2);
+                            }
+                        }
+
+                        return isa;
+                    }
+
+                    /**
+                     Micro-kernel used for T: the best instruction set of the CPU for float and double, portable otherwise
+                     */
+                    template <typename T>
+                    Isa instruction_set() {
+                        static const Isa isa = detect();
+                        return std::is_same<T, double>::value || std::is_same<T, float>::value ? isa : portable;
+                    }
+
+                } /* namespace kernel */
+
+                /**
+                 General matrix-matrix product for row-major storage: C += A · B
+
+                 @param m Number of rows of A and C
+                 @param n Number of columns of B and C
+                 @param k Number of columns of A and rows of B
+                 @param a Pointer to the first element of A
+                 @param lda Distance between two consecutive rows of A
+                 @param b Pointer to the first element of B
+                 @param ldb Distance between two consecutive rows of B
+                 @param c Pointer to the first element of C
+                 @param ldc Distance between two consecutive rows of C
+                 */
+                template <typename T>
+                void gemm(const size_t &m, const size_t &n, const size_t &k,
+                          const T *a, const size_t &lda,
+                          const T *b, const size_t &ldb,
+                          T *c, const size_t &ldc) {
+
+                    if (m == 0 || n == 0 || k == 0) {
+                        return;
+                    }
+
+                    //  Small products do not pay off the packing
+                    if (m * n * k <= CDA_GEMM_SMALL_PRODUCT) {
+                        for (size_t i = 0; i < m; ++i) {
+                            T *c_row = c + i * ldc;
+                            const T *a_row = a + i * lda;
+                            for (size_t p = 0; p < k; ++p) {
+                                const T a_ip = a_row[p];
+                                const T *b_row = b + p * ldb;
+                                for (size_t j = 0; j < n; ++j) {
+                                    c_row[j] += a_ip * b_row[j];
+                                }
+                            }
+                        }
+                        return;
+                    }
+
+                    switch (kernel::instruction_set<T>()) {
+                        case kernel::avx512:
+                            kernel::blocked<T, kernel::avx512>(m, n, k, a, lda, b, ldb, c, ldc);
+                            break;
+                        case kernel::avx2:
+                            kernel::blocked<T, kernel::avx2>(m, n, k, a, lda, b, ldb, c, ldc);
+                            break;
+                        default:
+                            kernel::blocked<T, kernel::portable>(m, n, k, a, lda, b, ldb, c, ldc);
+                            break;
+                    }
+                }
+
+            } /* namespace products */
+        } /* namespace algorithms */
+    } /* namespace math */
+} /* namespace cda */
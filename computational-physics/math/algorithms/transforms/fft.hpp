@@ -0,0 +1,263 @@
+//
+//  fft.hpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+namespace cda {
+    namespace math {
+        namespace algorithms {
+            namespace transforms {
+
+                /**
+                 Complex discrete Fourier transform of a fixed length, X_k = Σ x_j·e^(-2πi·jk/N), in O(N log N).
+
+                 Powers of two use an iterative radix-2 transform. Any other length is computed with
+                 Bluestein's algorithm as a circular convolution of a power-of-two length. Twiddle factors
+                 are computed once in the constructor, so one FFT can be shared by many threads as long as
+                 each of them passes its own buffer.
+                 */
+                template <typename ValueType = double>
+                class FFT {
+                public:
+                    typedef std::complex<ValueType> complex_type;
+
+                    explicit FFT(const size_t &size) : _size(size) {
+                        if (size == 0) {
+                            throw std::logic_error("FFT length must be positive.");
+                        }
+
+                        if (is_power_of_two(size)) {
+                            radix2_tables(size, twiddles, reversed);
+                            return;
+                        }
+
+                        //  Bluestein: x_j·w_j convolved with conj(w) and multiplied again by w_k, w_j = e^(-πi·j²/N)
+                        size_t length = 1;
+                        while (length < 2*size - 1) {
+                            length <<= 1;
+                        }
+                        radix2_tables(length, twiddles, reversed);
+
+                        chirp.resize(size);
+                        for (size_t j = 0; j < size; ++j) {
+                            //  j² mod 2N keeps the angle accurate for long transforms
+                            const ValueType angle = M_PI*ValueType((j*j) % (2*size))/size;
+                            chirp[j] = complex_type(std::cos(angle), -std::sin(angle));
+                        }
+
+                        filter.assign(length, complex_type(0));
+                        filter[0] = std::conj(chirp[0]);
+                        for (size_t j = 1; j < size; ++j) {
+                            filter[j] = filter[length - j] = std::conj(chirp[j]);
+                        }
+                        radix2(filter.data(), false);
+                    }
+
+                    const size_t &size() const {
+                        return _size;
+                    }
+
+                    /**
+                     Transforms \p data (size() values) in place
+
+                     @param buffer Scratch space, resized as needed. Reuse it between calls to avoid allocations
+                     */
+                    void forward(complex_type *data, std::vector<complex_type> &buffer) const {
+                        if (chirp.empty()) {
+                            radix2(data, false);
+                            return;
+                        }
+
+                        const size_t length = twiddles.size()*2;
+                        buffer.assign(length, complex_type(0));
+                        for (size_t j = 0; j < _size; ++j) {
+                            buffer[j] = data[j]*chirp[j];
+                        }
+
+                        radix2(buffer.data(), false);
+                        for (size_t k = 0; k < length; ++k) {
+                            buffer[k] *= filter[k];
+                        }
+                        radix2(buffer.data(), true);
+
+                        const ValueType scale = ValueType(1)/length;
+                        for (size_t k = 0; k < _size; ++k) {
+                            data[k] = buffer[k]*chirp[k]*scale;
+                        }
+                    }
+
+                private:
+                    size_t _size;
+
+                    //  Radix-2 tables of the power-of-two length actually transformed
+                    std::vector<complex_type> twiddles;
+                    std::vector<size_t> reversed;
+
+                    //  Bluestein only
+                    std::vector<complex_type> chirp, filter;
+
+                    static bool is_power_of_two(const size_t &n) {
+                        return (n & (n - 1)) == 0;
+                    }
+
+                    static void radix2_tables(const size_t &length, std::vector<complex_type> &twiddles,
+                                              std::vector<size_t> &reversed) {
+                        twiddles.resize(std::max<size_t>(length/2, 1));
+                        for (size_t k = 0; k < length/2; ++k) {
+                            const ValueType angle = 2*M_PI*ValueType(k)/length;
+                            twiddles[k] = complex_type(std::cos(angle), -std::sin(angle));
+                        }
+
+                        reversed.resize(length);
+                        size_t bits = 0;
+                        while ((size_t(1) << bits) < length) {
+                            ++bits;
+                        }
+                        for (size_t j = 0; j < length; ++j) {
+                            size_t r = 0;
+                            for (size_t b = 0; b < bits; ++b) {
+                                r |= ((j >> b) & 1) << (bits - 1 - b);
+                            }
+                            reversed[j] = r;
+                        }
+                    }
+
+                    //  Unnormalized in-place transform of reversed.size() values. inverse uses e^(+2πi·jk/N)
+                    void radix2(complex_type *data, const bool &inverse) const {
+                        const size_t length = reversed.size();
+
+                        for (size_t j = 0; j < length; ++j) {
+                            if (j < reversed[j]) {
+                                std::swap(data[j], data[reversed[j]]);
+                            }
+                        }
+
+                        for (size_t half = 1; half < length; half <<= 1) {
+                            const size_t step = length/(2*half);
+                            for (size_t start = 0; start < length; start += 2*half) {
+                                for (size_t k = 0; k < half; ++k) {
+                                    const complex_type w = inverse ? std::conj(twiddles[k*step]) : twiddles[k*step];
+                                    const complex_type odd = data[start + k + half]*w;
+                                    data[start + k + half] = data[start + k] - odd;
+                                    data[start + k] += odd;
+                                }
+                            }
+                        }
+                    }
+                };
+
+
+                /**
+                 Real-to-real trigonometric transforms of the discrete Laplacian's eigenvectors:
+
+                 - sine (DST-I) of n values:   X_k = Σ_{j=1..n} x_j·sin(π·jk/(n+1)), k = 1..n.
+                   Homogeneous Dirichlet ends outside the n values.
+                 - cosine (DCT-I) of n values: X_k = x_0/2 + (-1)^k·x_(n-1)/2 + Σ_{j=1..n-2} x_j·cos(π·jk/(n-1)).
+                   Homogeneous Neumann ends on the first and last value.
+
+                 Both are their own inverse up to a factor: applying one twice multiplies by
+                 (n+1)/2 or (n-1)/2 (scale()). They are computed through the FFT of the odd or even
+                 extension, two real sequences per complex transform.
+                 */
+                template <typename ValueType = double>
+                class TrigonometricTransform {
+                public:
+                    typedef std::complex<ValueType> complex_type;
+
+                    enum Kind { sine, cosine };
+
+                    TrigonometricTransform(const Kind &kind, const size_t &size) :
+                    _kind(kind), _size(size), fft(kind == sine ? 2*(size + 1) : 2*std::max<size_t>(size, 2) - 2) {
+                        if (kind == cosine && size < 2) {
+                            throw std::logic_error("The cosine transform needs at least 2 values.");
+                        }
+                    }
+
+                    const Kind &kind() const {
+                        return _kind;
+                    }
+
+                    const size_t &size() const {
+                        return _size;
+                    }
+
+                    /**
+                     Applying the transform twice multiplies by this value
+                     */
+                    ValueType scale() const {
+                        return _kind == sine ? ValueType(_size + 1)/2 : ValueType(_size - 1)/2;
+                    }
+
+                    /**
+                     Eigenvalue of the second difference u_(j-1) - 2u_j + u_(j+1) for the k-th vector of the
+                     transform (k = 0..size()-1): 2cos(θ) - 2 with θ = π(k+1)/(n+1) or π·k/(n-1)
+                     */
+                    ValueType eigenvalue(const size_t &k) const {
+                        const ValueType theta = _kind == sine ? M_PI*ValueType(k + 1)/(_size + 1) : M_PI*ValueType(k)/(_size - 1);
+                        return 2*std::cos(theta) - 2;
+                    }
+
+                    /**
+                     Transforms \p first and, if it is not nullptr, \p second in place (size() values each)
+
+                     @param work Scratch space for the extension, resized as needed
+                     @param buffer Scratch space of the FFT. Reuse both between calls to avoid allocations
+                     */
+                    void operator()(ValueType *first, ValueType *second,
+                                    std::vector<complex_type> &work, std::vector<complex_type> &buffer) const {
+                        const size_t length = fft.size();
+                        work.assign(length, complex_type(0));
+
+                        //  Odd or even extension of both sequences, the second one in the imaginary part
+                        for (size_t j = 0; j < _size; ++j) {
+                            const complex_type value(first[j], second ? second[j] : 0);
+                            if (_kind == sine) {
+                                work[j + 1] = value;
+                                work[length - j - 1] = -value;
+                            } else {
+                                work[j] = value;
+                                if (j > 0 && j < _size - 1) {
+                                    work[length - j] = value;
+                                }
+                            }
+                        }
+
+                        fft.forward(work.data(), buffer);
+
+                        //  Spectra of the two real extensions: (Z_k ± conj(Z_(N-k)))/2
+                        for (size_t k = 0; k < _size; ++k) {
+                            const size_t index = _kind == sine ? k + 1 : k;
+                            const complex_type z = work[index], w = std::conj(work[(length - index) % length]);
+                            const complex_type a = (z + w)*ValueType(0.5), b = (z - w)*complex_type(0, -0.5);
+
+                            //  Y = -2i·DST for the odd extension and Y = 2·DCT for the even one
+                            first[k] = _kind == sine ? -a.imag()/2 : a.real()/2;
+                            if (second) {
+                                second[k] = _kind == sine ? -b.imag()/2 : b.real()/2;
+                            }
+                        }
+                    }
+
+                private:
+                    Kind _kind;
+                    size_t _size;
+                    FFT<ValueType> fft;
+                };
+
+            } /* namespace transforms */
+        } /* namespace algorithms */
+    } /* namespace math */
+} /* namespace cda */
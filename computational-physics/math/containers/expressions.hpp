@@ -0,0 +1,411 @@
+//
+//  expressions.hpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../memory/allocators.hpp"
+
+
+namespace cda {
+    namespace math {
+        namespace containers {
+
+            //  Default template arguments live here, in the first declaration
+            template <typename T, typename Allocator = memory::AlignedAllocator<T>> class Matrix;
+            template <typename T, typename Allocator = memory::AlignedAllocator<T>> class Vector;
+        } /* namespace containers */
+    } /* namespace math */
+} /* namespace cda */
+
+//  Defined with the containers, declared here for the streaming of nodes
+template <typename ValueType, typename Allocator>
+std::ostream& operator<<(std::ostream &output, const cda::math::containers::Matrix<ValueType, Allocator> &matrix);
+
+template <typename ValueType, typename Allocator>
+std::ostream& operator<<(std::ostream &output, const cda::math::containers::Vector<ValueType, Allocator> &vector);
+
+namespace cda {
+    namespace math {
+        namespace containers {
+
+            /**
+             Lazy element-wise arithmetic for Matrix and Vector.
+
+             Operators return lightweight nodes instead of containers. A node is evaluated
+             element by element when it is assigned to a container, so a chain like
+             `a + 2.0 * (b - c)` makes one pass over memory and one allocation.
+             Containers are held by reference when they are lvalues and by value when
+             they are temporaries, so nodes stored with `auto` remain valid.
+             */
+            namespace expressions {
+
+                struct MatrixTag {
+                    template <typename T>
+                    using container = Matrix<T>;
+
+                    template <typename Left, typename Right>
+                    static bool same_dimensions(const Left &left, const Right &right) {
+                        return left.rows() == right.rows() && left.columns() == right.columns();
+                    }
+
+                    template <typename Left, typename Right>
+                    static void check_dimensions(const Left &left, const Right &right) {
+                        if (!same_dimensions(left, right)) {
+                            throw std::logic_error("Matrices must be of the same dimensions.");
+                        }
+                    }
+                };
+
+                struct VectorTag {
+                    template <typename T>
+                    using container = Vector<T>;
+
+                    template <typename Left, typename Right>
+                    static bool same_dimensions(const Left &left, const Right &right) {
+                        return left.size() == right.size();
+                    }
+
+                    template <typename Left, typename Right>
+                    static void check_dimensions(const Left &left, const Right &right) {
+                        if (!same_dimensions(left, right)) {
+                            throw std::logic_error("Vectors must be of the same size");
+                        }
+                    }
+                };
+
+                //  Base of containers and nodes
+                template <typename Tag>
+                struct Expression {
+                    typedef Tag tag;
+                };
+
+                //  --- TRAITS ---
+                template <typename E, typename Tag>
+                using is_expression = std::is_base_of<Expression<Tag>, typename std::decay<E>::type>;
+
+                template <typename E>
+                struct is_container : std::false_type {};
+
+                template <typename T, typename Allocator>
+                struct is_container<Matrix<T, Allocator>> : std::true_type {};
+
+                template <typename T, typename Allocator>
+                struct is_container<Vector<T, Allocator>> : std::true_type {};
+
+                //  Expression which is not a container
+                template <typename E, typename Tag>
+                using is_node = std::integral_constant<bool, is_expression<E, Tag>::value &&
+                                                             !is_container<typename std::decay<E>::type>::value>;
+
+                template <typename Left, typename Right, typename Tag>
+                using are_expressions = std::integral_constant<bool, is_expression<Left, Tag>::value &&
+                                                                     is_expression<Right, Tag>::value>;
+
+                //  At least one side must be a node, containers keep their own operators
+                template <typename Left, typename Right, typename Tag>
+                using involve_nodes = std::integral_constant<bool, are_expressions<Left, Right, Tag>::value &&
+                                                                   (is_node<Left, Tag>::value || is_node<Right, Tag>::value)>;
+
+                template <typename E>
+                using tag_of = typename std::decay<E>::type::tag;
+
+                template <typename E>
+                using value_of = typename std::decay<E>::type::value_type;
+
+                template <typename E>
+                using operand = typename std::conditional<std::is_lvalue_reference<E>::value &&
+                                                          is_container<typename std::decay<E>::type>::value,
+                                                          const typename std::decay<E>::type &,
+                                                          typename std::decay<E>::type>::type;
+
+                //  --- OPERATIONS ---
+                struct Plus {
+                    template <typename T>
+                    static T apply(const T &left, const T &right) { return left + right; }
+                };
+
+                struct Minus {
+                    template <typename T>
+                    static T apply(const T &left, const T &right) { return left - right; }
+                };
+
+                struct Multiplies {
+                    template <typename T>
+                    static T apply(const T &left, const T &right) { return left * right; }
+                };
+
+                struct Divides {
+                    template <typename T>
+                    static T apply(const T &left, const T &right) { return left / right; }
+                };
+
+                //  --- NODES ---
+                /**
+                 Nodes convert implicitly to their container (see the Matrix and Vector constructors) and
+                 answer the container's value-returning member functions by evaluating first, so
+                 `(a * 2.0).sqrt()` or `(a - b).transpose()` work as they did with eager operators.
+                 Each call evaluates the node again: store the result in a container to reuse it.
+                 */
+                template <typename Derived, typename Tag>
+                class Node : public Expression<Tag> {
+                private:
+                    template <typename Self>
+                    using container = typename Tag::template container<typename Self::value_type>;
+
+                public:
+                    /**
+                     Evaluates the expression into a new container
+                     */
+                    template <typename Self = Derived>
+                    container<Self> eval() const {
+                        return container<Self>(static_cast<const Derived &>(*this));
+                    }
+
+                    //  --- MEMBERS OF BOTH CONTAINERS ---
+                    template <typename Power, typename Self = Derived>
+                    auto pow(const Power &power) const -> decltype(std::declval<const container<Self> &>().pow(power)) {
+                        return eval().pow(power);
+                    }
+
+                    template <typename Self = Derived>
+                    auto max_element() const -> decltype(std::declval<const container<Self> &>().max_element()) {
+                        return eval().max_element();
+                    }
+
+                    template <typename Self = Derived>
+                    auto min_element() const -> decltype(std::declval<const container<Self> &>().min_element()) {
+                        return eval().min_element();
+                    }
+
+                    template <typename Self = Derived>
+                    auto abs_max_element() const -> decltype(std::declval<const container<Self> &>().abs_max_element()) {
+                        return eval().abs_max_element();
+                    }
+
+                    template <typename Self = Derived>
+                    auto abs_min_element() const -> decltype(std::declval<const container<Self> &>().abs_min_element()) {
+                        return eval().abs_min_element();
+                    }
+
+                    template <typename Self = Derived>
+                    auto is_null() const -> decltype(std::declval<const container<Self> &>().is_null()) {
+                        return eval().is_null();
+                    }
+
+                    //  --- VECTOR MEMBERS ---
+                    template <typename Self = Derived>
+                    auto sqrt() const -> decltype(std::declval<const container<Self> &>().sqrt()) {
+                        return eval().sqrt();
+                    }
+
+                    template <typename Self = Derived>
+                    auto sum() const -> decltype(std::declval<const container<Self> &>().sum()) {
+                        return eval().sum();
+                    }
+
+                    template <typename Self = Derived>
+                    auto norm() const -> decltype(std::declval<const container<Self> &>().norm()) {
+                        return eval().norm();
+                    }
+
+                    template <typename Self = Derived>
+                    auto normalized_vector() const -> decltype(std::declval<const container<Self> &>().normalized_vector()) {
+                        return eval().normalized_vector();
+                    }
+
+                    //  --- MATRIX MEMBERS ---
+                    template <typename Self = Derived>
+                    auto transpose() const -> decltype(std::declval<const container<Self> &>().transpose()) {
+                        return eval().transpose();
+                    }
+
+                    template <typename Self = Derived>
+                    auto determinant() const -> decltype(std::declval<const container<Self> &>().determinant()) {
+                        return eval().determinant();
+                    }
+
+                    template <typename Self = Derived>
+                    auto get_diagonal() const -> decltype(std::declval<const container<Self> &>().get_diagonal()) {
+                        return eval().get_diagonal();
+                    }
+                };
+
+                template <typename Tag, typename Operation, typename Left, typename Right>
+                class Binary : public Node<Binary<Tag, Operation, Left, Right>, Tag> {
+                private:
+                    Left left;
+                    Right right;
+
+                public:
+                    typedef value_of<Left> value_type;
+
+                    template <typename L, typename R>
+                    Binary(L &&left, R &&right) :
+                    left(std::forward<L>(left)), right(std::forward<R>(right)) {
+                        Tag::check_dimensions(this->left, this->right);
+                    }
+
+                    size_t rows() const { return left.rows(); }
+                    size_t columns() const { return left.columns(); }
+                    size_t size() const { return left.size(); }
+
+                    value_type element(const size_t &index) const {
+                        return Operation::apply(static_cast<value_type>(left.element(index)),
+                                                static_cast<value_type>(right.element(index)));
+                    }
+                };
+
+                template <typename Tag, typename Operation, typename E>
+                class Scalar : public Node<Scalar<Tag, Operation, E>, Tag> {
+                private:
+                    E expression;
+                    value_of<E> value;
+
+                public:
+                    typedef value_of<E> value_type;
+
+                    template <typename Expression>
+                    Scalar(Expression &&expression, const value_type &value) :
+                    expression(std::forward<Expression>(expression)), value(value) {
+                    }
+
+                    size_t rows() const { return expression.rows(); }
+                    size_t columns() const { return expression.columns(); }
+                    size_t size() const { return expression.size(); }
+
+                    value_type element(const size_t &index) const {
+                        return Operation::apply(static_cast<value_type>(expression.element(index)), value);
+                    }
+                };
+
+                template <typename Tag, typename E>
+                class Negate : public Node<Negate<Tag, E>, Tag> {
+                private:
+                    E expression;
+
+                public:
+                    typedef value_of<E> value_type;
+
+                    template <typename Expression,
+                              typename = typename std::enable_if<!std::is_same<typename std::decay<Expression>::type, Negate>::value>::type>
+                    explicit Negate(Expression &&expression) :
+                    expression(std::forward<Expression>(expression)) {
+                    }
+
+                    size_t rows() const { return expression.rows(); }
+                    size_t columns() const { return expression.columns(); }
+                    size_t size() const { return expression.size(); }
+
+                    value_type element(const size_t &index) const {
+                        return -expression.element(index);
+                    }
+                };
+
+                //  --- OPERATORS ---
+                template <typename Left, typename Right,
+                          typename = typename std::enable_if<are_expressions<Left, Right, tag_of<Left>>::value>::type>
+                Binary<tag_of<Left>, Plus, operand<Left>, operand<Right>> operator+(Left &&left, Right &&right) {
+                    return Binary<tag_of<Left>, Plus, operand<Left>, operand<Right>>(std::forward<Left>(left),
+                                                                                     std::forward<Right>(right));
+                }
+
+                template <typename Left, typename Right,
+                          typename = typename std::enable_if<are_expressions<Left, Right, tag_of<Left>>::value>::type>
+                Binary<tag_of<Left>, Minus, operand<Left>, operand<Right>> operator-(Left &&left, Right &&right) {
+                    return Binary<tag_of<Left>, Minus, operand<Left>, operand<Right>>(std::forward<Left>(left),
+                                                                                      std::forward<Right>(right));
+                }
+
+                template <typename E,
+                          typename = typename std::enable_if<is_expression<E, tag_of<E>>::value>::type>
+                Negate<tag_of<E>, operand<E>> operator-(E &&expression) {
+                    return Negate<tag_of<E>, operand<E>>(std::forward<E>(expression));
+                }
+
+                template <typename E, typename T,
+                          typename = typename std::enable_if<is_expression<E, tag_of<E>>::value &&
+                                                             std::is_arithmetic<T>::value>::type>
+                Scalar<tag_of<E>, Multiplies, operand<E>> operator*(E &&expression, const T &value) {
+                    return Scalar<tag_of<E>, Multiplies, operand<E>>(std::forward<E>(expression),
+                                                                     static_cast<value_of<E>>(value));
+                }
+
+                template <typename T, typename E,
+                          typename = typename std::enable_if<is_expression<E, tag_of<E>>::value &&
+                                                             std::is_arithmetic<T>::value>::type>
+                Scalar<tag_of<E>, Multiplies, operand<E>> operator*(const T &value, E &&expression) {
+                    return Scalar<tag_of<E>, Multiplies, operand<E>>(std::forward<E>(expression),
+                                                                     static_cast<value_of<E>>(value));
+                }
+
+                template <typename E, typename T,
+                          typename = typename std::enable_if<is_expression<E, tag_of<E>>::value &&
+                                                             std::is_arithmetic<T>::value>::type>
+                Scalar<tag_of<E>, Divides, operand<E>> operator/(E &&expression, const T &value) {
+                    return Scalar<tag_of<E>, Divides, operand<E>>(std::forward<E>(expression),
+                                                                  static_cast<value_of<E>>(value));
+                }
+
+                //  Matrix product of nodes: operands are evaluated and multiplied eagerly
+                template <typename Left, typename Right>
+                typename std::enable_if<involve_nodes<Left, Right, MatrixTag>::value, Matrix<value_of<Left>>>::type
+                operator*(const Left &left, const Right &right) {
+                    return Matrix<value_of<Left>>(left) * Matrix<value_of<Left>>(right);
+                }
+
+                //  Dot product of nodes
+                template <typename Left, typename Right>
+                typename std::enable_if<involve_nodes<Left, Right, VectorTag>::value, value_of<Left>>::type
+                operator*(const Left &left, const Right &right) {
+                    VectorTag::check_dimensions(left, right);
+
+                    value_of<Left> value(0);
+                    for (size_t index = 0; index < left.size(); ++index) {
+                        value += left.element(index) * right.element(index);
+                    }
+                    return value;
+                }
+
+                template <typename Left, typename Right,
+                          typename = typename std::enable_if<involve_nodes<Left, Right, tag_of<Left>>::value>::type>
+                bool operator==(const Left &left, const Right &right) {
+                    if (!tag_of<Left>::same_dimensions(left, right)) {
+                        return false;
+                    }
+
+                    for (size_t index = 0; index < left.size(); ++index) {
+                        if (left.element(index) != right.element(index)) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                template <typename Left, typename Right,
+                          typename = typename std::enable_if<involve_nodes<Left, Right, tag_of<Left>>::value>::type>
+                bool operator!=(const Left &left, const Right &right) {
+                    return !(left == right);
+                }
+
+                //  Streams the evaluated container
+                template <typename E,
+                          typename = typename std::enable_if<is_node<E, tag_of<E>>::value>::type>
+                std::ostream &operator<<(std::ostream &output, const E &expression) {
+                    return ::operator<<(output, expression.eval());
+                }
+
+            } /* namespace expressions */
+        } /* namespace containers */
+    } /* namespace math */
+} /* namespace cda */
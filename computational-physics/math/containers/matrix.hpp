@@ -15,10 +15,15 @@
 #include <sstream>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
 
 #include "../algorithms/find.hpp"
 #include "../algorithms/factorization/lu.hpp"
+#include "../algorithms/products/gemm.hpp"
+#include "../parallel/thread_pool.hpp"
+#include "expressions.hpp"
 #include "vector.hpp"
+#include "views.hpp"
 
 
 namespace cda {
@@ -26,8 +31,8 @@ namespace cda {
         namespace containers {
         
             //  --- MATRIX CLASS ---
-            template <typename T>
-            class Matrix {
+            template <typename T, typename Allocator>
+            class Matrix : public expressions::Expression<expressions::MatrixTag> {
             private:
                 
                 typedef typename std::conditional<std::is_floating_point<T>::value, T, float>::type lu_value_type;
@@ -35,23 +40,26 @@ namespace cda {
                 size_t n, m, mat_size;
                 T *a, *it_end;
                 
+                //  Keeps the first min(mat_size, size) elements, mat_size must still hold the current size
                 void alloc_memory(const size_t &size) {
-                    if (size == 0) {
-                        std::free(a);
-                        a = it_end = nullptr;
-                    } else {
-                        if (void *mem = std::realloc(a, size * sizeof(T))) {
-                            a = static_cast<T *>(mem);
-                            it_end = a + size;
-                        } else {
-                            throw std::bad_alloc();
+                    a = memory::reallocate(Allocator(), a, a ? mat_size : 0, size);
+                    it_end = a ? a + size : nullptr;
+                }
+                
+                template <typename Expression>
+                void evaluate(const Expression &expression) {
+                    const auto it = this->begin();
+                    parallel::parallel_for(0, mat_size, [&](const size_t &from, const size_t &to) {
+                        for (size_t i = from; i < to; ++i) {
+                            it[i] = expression.element(i);
                         }
-                    }
+                    });
                 }
                 
             public:
                 
                 typedef T value_type;
+                typedef Allocator allocator_type;
                 
                 Matrix(const size_t &rows = 0, const size_t &columns = 0) :
                 n(rows), m(columns), mat_size(rows * columns),
@@ -66,28 +74,37 @@ namespace cda {
                     std::fill(this->begin(), this->end(), value);
                 }
                 
-                Matrix(const Matrix<value_type> &matrix) :
+                Matrix(const Matrix &matrix) :
                 n(matrix.n), m(matrix.m), mat_size(matrix.mat_size),
                 a(nullptr), it_end(nullptr) {
                     alloc_memory(mat_size);
                     std::copy(matrix.begin(), matrix.end(), this->begin());
                 }
                 
-                template<typename ValueType2>
-                Matrix(const Matrix<ValueType2> &matrix) :
+                template<typename ValueType2, typename Allocator2>
+                Matrix(const Matrix<ValueType2, Allocator2> &matrix) :
                 n(matrix.rows()), m(matrix.columns()), mat_size(matrix.size()),
                 a(nullptr), it_end(nullptr) {
                     alloc_memory(mat_size);
                     std::copy(matrix.begin(), matrix.end(), this->begin());
                 }
                 
-                Matrix(Matrix<value_type> &&matrix) :
+                Matrix(Matrix &&matrix) :
                 n(matrix.n), m(matrix.m), mat_size(matrix.mat_size),
                 a(matrix.a), it_end(matrix.it_end) {
                     matrix.n = matrix.m = matrix.mat_size = 0;
                     matrix.a = matrix.it_end = nullptr;
                 }
                 
+                template <typename Expression,
+                          typename = typename std::enable_if<expressions::is_node<Expression, expressions::MatrixTag>::value>::type>
+                Matrix(const Expression &expression) :
+                n(expression.rows()), m(expression.columns()), mat_size(n * m),
+                a(nullptr), it_end(nullptr) {
+                    alloc_memory(mat_size);
+                    evaluate(expression);
+                }
+                
                 template <size_t size>
                 Matrix(const size_t &rows, const size_t &columns, const value_type (&values)[size]):
                 n(rows), m(columns), mat_size(rows * columns),
@@ -111,7 +128,7 @@ namespace cda {
                 
                 ~Matrix() {
                     if (a) {
-                        std::free(a);
+                        Allocator().deallocate(a, mat_size);
                         a = it_end = nullptr;
                         n = m = mat_size = 0;
                     }
@@ -125,6 +142,10 @@ namespace cda {
                     return it_end;
                 }
                 
+                const value_type &element(const size_t &index) const {
+                    return a[index];
+                }
+                
                 void resize(const size_t &rows, const size_t &columns, const bool &fill = false) {
                     if (rows == n && columns == m) {
                         return;
@@ -142,7 +163,7 @@ namespace cda {
                         mat_size = new_size;
                     } else {
                         
-                        Matrix<value_type> tmp(rows, columns);
+                        Matrix tmp(rows, columns);
                         if (fill) {
                             tmp.zero();
                         }
@@ -171,7 +192,7 @@ namespace cda {
                     this->m = columns;
                 }
                 
-                Matrix<value_type> &operator=(const Matrix<value_type> &matrix) {
+                Matrix &operator=(const Matrix &matrix) {
                     if (this != &matrix) {
                         resize(matrix.n, matrix.m);
                         std::copy(matrix.begin(), matrix.end(), this->begin());
@@ -180,9 +201,11 @@ namespace cda {
                     return *this;
                 }
                 
-                Matrix<value_type> &operator=(Matrix<value_type> &&matrix) {
+                Matrix &operator=(Matrix &&matrix) {
                     if (this != &matrix) {
-                        std::free(a);
+                        if (a) {
+                            Allocator().deallocate(a, mat_size);
+                        }
                         a = matrix.a;
                         it_end = matrix.it_end;
                         n = matrix.n;
@@ -196,7 +219,16 @@ namespace cda {
                     return *this;
                 }
                 
-                bool operator==(const Matrix<value_type> &matrix) const {
+                template <typename Expression,
+                          typename = typename std::enable_if<expressions::is_node<Expression, expressions::MatrixTag>::value>::type>
+                Matrix &operator=(const Expression &expression) {
+                    //  Element-wise nodes only read index i to write index i, so aliasing *this is safe
+                    resize(expression.rows(), expression.columns());
+                    evaluate(expression);
+                    return *this;
+                }
+                
+                bool operator==(const Matrix &matrix) const {
                     if (this->n != matrix.n || this->m != matrix.m) {
                         return false;
                     }
@@ -211,16 +243,16 @@ namespace cda {
                     return true;
                 }
                 
-                bool operator!=(const Matrix<value_type> &matrix) const {
+                bool operator!=(const Matrix &matrix) const {
                     return !this->operator==(matrix);
                 }
                 
-                Matrix<value_type> get_row(const size_t &row) const {
+                Matrix get_row(const size_t &row) const {
                     if (row >= n) {
                         throw std::out_of_range("Index out of bounds");
                     }
                     
-                    Matrix<value_type> tmp(1, m);
+                    Matrix tmp(1, m);
                     
                     const auto &it_row = this->operator[](row);
                     std::copy(it_row, it_row + m, tmp.begin());
@@ -228,12 +260,12 @@ namespace cda {
                     return tmp;
                 }
                 
-                Matrix<value_type> get_column(const size_t &column) const {
+                Matrix get_column(const size_t &column) const {
                     if (column >= m) {
                         throw std::out_of_range("Index out of bounds");
                     }
                     
-                    Matrix<value_type> tmp(n, 1);
+                    Matrix tmp(n, 1);
                     auto it_tmp = tmp.begin();
                     
                     for (size_t i = 0; i < n; ++i, ++it_tmp) {
@@ -243,13 +275,13 @@ namespace cda {
                     return tmp;
                 }
                 
-                Matrix<value_type> get_matrix(const size_t &row, const size_t &column,
+                Matrix get_matrix(const size_t &row, const size_t &column,
                                               const size_t &number_of_rows, const size_t &number_of_columns) const {
                     if (row + number_of_rows > n || column + number_of_columns > m) {
                         throw std::out_of_range("Index out of bounds");
                     }
                     
-                    Matrix<value_type> tmp(number_of_rows, number_of_columns);
+                    Matrix tmp(number_of_rows, number_of_columns);
                     
                     auto it_this = begin() + row * m + column;
                     for (auto it_tmp = tmp.begin(); it_tmp != tmp.end(); it_tmp += number_of_columns, it_this += m) {
@@ -259,7 +291,7 @@ namespace cda {
                     return tmp;
                 }
                 
-                Matrix<value_type> get_matrix(const size_t &row, const size_t &column) const {
+                Matrix get_matrix(const size_t &row, const size_t &column) const {
                     return this->get_matrix(row, column, n - row, m - column);
                 }
                 
@@ -303,9 +335,67 @@ namespace cda {
                     
                     return vector;
                 }
-                
+
+                //  Views (no copies, valid while the matrix is not resized)
+                VectorView<value_type> row_view(const size_t &row, const size_t &from_column = 0) {
+                    if (row >= this->n || from_column > this->m) {
+                        throw std::out_of_range("Index out of bounds.");
+                    }
+                    return VectorView<value_type>(this->operator[](row) + from_column, this->m - from_column);
+                }
+
+                VectorView<const value_type> row_view(const size_t &row, const size_t &from_column = 0) const {
+                    return const_cast<Matrix *>(this)->row_view(row, from_column);
+                }
+
+                VectorView<value_type> column_view(const size_t &column, const size_t &from_row = 0) {
+                    if (column >= this->m || from_row > this->n) {
+                        throw std::out_of_range("Index out of bounds.");
+                    }
+                    return VectorView<value_type>(a + this->m * from_row + column, this->n - from_row, this->m);
+                }
+
+                VectorView<const value_type> column_view(const size_t &column, const size_t &from_row = 0) const {
+                    return const_cast<Matrix *>(this)->column_view(column, from_row);
+                }
+
+                VectorView<value_type> diagonal_view() {
+                    if (!this->is_square()) {
+                        throw std::logic_error("Matrix must be an square matrix");
+                    }
+                    return VectorView<value_type>(a, this->n, this->m + 1);
+                }
+
+                VectorView<const value_type> diagonal_view() const {
+                    return const_cast<Matrix *>(this)->diagonal_view();
+                }
+
+                MatrixView<value_type> matrix_view(const size_t &row, const size_t &column,
+                                                   const size_t &number_of_rows, const size_t &number_of_columns) {
+                    if (row + number_of_rows > n || column + number_of_columns > m) {
+                        throw std::out_of_range("Index out of bounds");
+                    }
+                    return MatrixView<value_type>(a + row * m + column, number_of_rows, number_of_columns, m);
+                }
+
+                MatrixView<const value_type> matrix_view(const size_t &row, const size_t &column,
+                                                         const size_t &number_of_rows, const size_t &number_of_columns) const {
+                    if (row + number_of_rows > n || column + number_of_columns > m) {
+                        throw std::out_of_range("Index out of bounds");
+                    }
+                    return MatrixView<const value_type>(a + row * m + column, number_of_rows, number_of_columns, m);
+                }
+
+                MatrixView<value_type> matrix_view(const size_t &row = 0, const size_t &column = 0) {
+                    return this->matrix_view(row, column, n - row, m - column);
+                }
+
+                MatrixView<const value_type> matrix_view(const size_t &row = 0, const size_t &column = 0) const {
+                    return this->matrix_view(row, column, n - row, m - column);
+                }
+
                 //  Sets
-                void set_column(const size_t &column, const Matrix<value_type> &matrix) {
+                void set_column(const size_t &column, const Matrix &matrix) {
                     if (column >= this->m) {
                         throw std::out_of_range("Index out of bounds.");
                     }
@@ -339,7 +429,7 @@ namespace cda {
                     }
                 }
                 
-                void set_row(const size_t &row, const Matrix<value_type> &matrix) {
+                void set_row(const size_t &row, const Matrix &matrix) {
                     if (row >= this->n) {
                         throw std::out_of_range("Index out of bounds.");
                     }
@@ -397,7 +487,7 @@ namespace cda {
                     }
                 }
                 
-                void set_matrix(const size_t &row, const size_t &column, const Matrix<value_type> &matrix) {
+                void set_matrix(const size_t &row, const size_t &column, const Matrix &matrix) {
                     if (row >= this->n || column >= this->m) {
                         throw std::out_of_range("Index out of bounds.");
                     }
@@ -430,16 +520,19 @@ namespace cda {
                     return mat_size;
                 }
                 
-                Matrix<value_type> sum_rows() const {
-                    Matrix<value_type> sum_rows(n, 1, 0);
+                Matrix sum_rows() const {
+                    Matrix sum_rows(n, 1, 0);
                     
-                    auto it_this = this->begin();
-                    for (auto it_sum = sum_rows.begin(); it_sum != sum_rows.end(); ++it_sum) {
-                        auto it_this_row_end = it_this + this->m;
-                        for (; it_this != it_this_row_end; ++it_this) {
-                            *it_sum += *it_this;
+                    const auto it_sum = sum_rows.begin();
+                    parallel::parallel_for(0, n, [&](const size_t &from, const size_t &to) {
+                        auto it_this = this->operator[](from);
+                        for (size_t row = from; row < to; ++row) {
+                            const auto it_this_row_end = it_this + this->m;
+                            for (; it_this != it_this_row_end; ++it_this) {
+                                it_sum[row] += *it_this;
+                            }
                         }
-                    }
+                    }, CDA_PARALLEL_GRAIN / std::max<size_t>(m, 1) + 1);
                     
                     return sum_rows;
                 }
@@ -463,14 +556,18 @@ namespace cda {
                     return sum;
                 }
                 
-                Matrix<value_type> sum_columns() const {
-                    Matrix<value_type> sum_columns(1, m, 0);
+                Matrix sum_columns() const {
+                    Matrix sum_columns(1, m, 0);
                     
-                    for (auto it_this = this->begin(); it_this != this->end();) {
-                        for (auto it_sum = sum_columns.begin(); it_sum != sum_columns.end(); ++it_sum, ++it_this) {
-                            *it_sum += *it_this;
+                    //  Every task accumulates a band of columns, walking the rows in order
+                    const auto it_sum = sum_columns.begin();
+                    parallel::parallel_for(0, m, [&](const size_t &from, const size_t &to) {
+                        for (auto it_this = this->begin(); it_this != this->end(); it_this += this->m) {
+                            for (size_t column = from; column < to; ++column) {
+                                it_sum[column] += it_this[column];
+                            }
                         }
-                    }
+                    }, CDA_PARALLEL_GRAIN / std::max<size_t>(n, 1) + 1);
                     
                     return sum_columns;
                 }
@@ -540,8 +637,8 @@ namespace cda {
                     return &a[row * m];
                 }
                 
-                Matrix<value_type> transpose() const {
-                    Matrix<value_type> new_matrix(this->m, this->n);
+                Matrix transpose() const {
+                    Matrix new_matrix(this->m, this->n);
                     
                     for (size_t row = 0; row < this->n; ++row) {
                         for (size_t column = 0; column < this->m; ++column) {
@@ -557,6 +654,17 @@ namespace cda {
                     n = m = mat_size = 0;
                 }
                 
+                /**
+                 Exchanges the contents of two matrices without copying nor allocating
+                 */
+                void swap(Matrix &matrix) noexcept {
+                    std::swap(n, matrix.n);
+                    std::swap(m, matrix.m);
+                    std::swap(mat_size, matrix.mat_size);
+                    std::swap(a, matrix.a);
+                    std::swap(it_end, matrix.it_end);
+                }
+                
                 bool is_empty() const {
                     return mat_size == 0;
                 }
@@ -630,117 +738,61 @@ namespace cda {
                     }
                 }
                 
-                Matrix<value_type> operator+(const Matrix<value_type> &matrix) const {
-                    if (this->n != matrix.n || this->m != matrix.m) {
-                        throw std::logic_error("Matrices must be of the same dimensions.");
-                    }
-                    
-                    Matrix<value_type> new_matrix(n, m);
-                    auto it_new = new_matrix.begin();
-                    auto it_matrix = matrix.begin();
-                    
-                    for (auto it_this = this->begin(); it_this != this->end(); ++it_this, ++it_matrix, ++it_new) {
-                        *it_new = *it_this + *it_matrix;
-                    }
+                template <typename Expression,
+                          typename = typename std::enable_if<expressions::is_expression<Expression, expressions::MatrixTag>::value>::type>
+                Matrix& operator+=(const Expression &expression) {
+                    expressions::MatrixTag::check_dimensions(*this, expression);
                     
-                    return new_matrix;
-                }
-                
-                Matrix<value_type>& operator+=(const Matrix<value_type> &matrix) {
-                    if (this->n != matrix.n || this->m != matrix.m) {
-                        throw std::logic_error("Matrices must be of the same dimensions.");
-                    }
-                    
-                    auto it_this = this->begin();
-                    for (auto it_matrix = matrix.begin(); it_matrix != matrix.end(); ++it_matrix) {
-                        *it_this++ += *it_matrix;
-                    }
+                    const auto it_this = this->begin();
+                    parallel::parallel_for(0, mat_size, [&](const size_t &from, const size_t &to) {
+                        for (size_t i = from; i < to; ++i) {
+                            it_this[i] += expression.element(i);
+                        }
+                    });
                     
                     return *this;
                 }
                 
-                Matrix<value_type> operator-(const Matrix<value_type> &matrix) const {
-                    if (this->n != matrix.n || this->m != matrix.m) {
-                        throw std::logic_error("Matrices must be of the same dimensions.");
-                    }
-                    
-                    Matrix<value_type> new_matrix(n, m);
-                    auto it_new = new_matrix.begin();
-                    auto it_matrix = matrix.begin();
-                    
-                    for (auto it_this = this->begin(); it_this != this->end(); ++it_this, ++it_matrix, ++it_new) {
-                        *it_new = *it_this - *it_matrix;
-                    }
-                    
-                    return new_matrix;
-                }
-                
-                Matrix<value_type>& operator-=(const Matrix<value_type> &matrix) {
-                    if (this->n != matrix.n || this->m != matrix.m) {
-                        throw std::logic_error("Matrices must be of the same dimensions.");
-                    }
+                template <typename Expression,
+                          typename = typename std::enable_if<expressions::is_expression<Expression, expressions::MatrixTag>::value>::type>
+                Matrix& operator-=(const Expression &expression) {
+                    expressions::MatrixTag::check_dimensions(*this, expression);
                     
-                    auto it_this = this->begin();
-                    for (auto it_matrix = matrix.begin(); it_matrix != matrix.end(); ++it_matrix) {
-                        *it_this++ -= *it_matrix;
-                    }
+                    const auto it_this = this->begin();
+                    parallel::parallel_for(0, mat_size, [&](const size_t &from, const size_t &to) {
+                        for (size_t i = from; i < to; ++i) {
+                            it_this[i] -= expression.element(i);
+                        }
+                    });
                     
                     return *this;
                 }
                 
-                Matrix<value_type> operator*(const value_type &value) const {
-                    Matrix<value_type> new_matrix(n, m);
-                    auto it_new = new_matrix.begin();
-                    
-                    for (auto it_this = this->begin(); it_this != this->end(); ++it_this) {
-                        *it_new++ = *it_this * value;
-                    }
-                    
-                    return new_matrix;
-                }
-                
-                Matrix<value_type> operator*(const Matrix<value_type> &matrix) const {
+                Matrix operator*(const Matrix &matrix) const {
                     if (this->m != matrix.n) {
                         throw std::logic_error("Matrices dimensions are not compatible.");
                     }
                     
-                    Matrix<value_type> new_matrix(this->n, matrix.m);
-                    auto it_new_matrix = new_matrix.begin();
-                    
-                    const value_type *it_this_row, *it_this_row__, *it_end_this_row;
-                    
-                    value_type sum;
-                    size_t matrix_column;
-                    value_type *it_matrix_column;
-                    
-                    for (it_this_row = this->begin(); it_this_row < this->end(); it_this_row = it_end_this_row) {
-                        it_end_this_row = it_this_row + this->m;
-                        
-                        for (matrix_column = 0; matrix_column < matrix.m; ++matrix_column) {
-                            sum = 0;
-                            for (it_this_row__ = it_this_row, it_matrix_column = matrix.begin() + matrix_column;
-                                 it_this_row__ != it_end_this_row;
-                                 ++it_this_row__, it_matrix_column += matrix.m) {
-                                sum += *it_this_row__ * *it_matrix_column;
-                            }
-                            *it_new_matrix++ = sum;
-                        }
-                    }
+                    Matrix new_matrix(this->n, matrix.m, 0);
+                    algorithms::products::gemm(this->n, matrix.m, this->m,
+                                               this->begin(), this->m,
+                                               matrix.begin(), matrix.m,
+                                               new_matrix.begin(), new_matrix.m);
                     
                     return new_matrix;
                 }
                 
-                Matrix<value_type> &operator*=(const Matrix<value_type> &matrix) {
+                Matrix &operator*=(const Matrix &matrix) {
                     *this = *this * matrix;
                     return *this;
                 }
                 
-                Matrix<value_type> operator*(const Vector<value_type> &vector) {
+                Matrix operator*(const Vector<value_type> &vector) {
                     if (m != 1) {
                         throw std::logic_error("Matrix and Vector are not compatible.");
                     }
                     
-                    Matrix<value_type> new_matrix(n, vector.size());
+                    Matrix new_matrix(n, vector.size());
                     auto it_new = new_matrix.begin();
                     
                     for (auto it_this = this->begin(); it_this != this->end(); ++it_this) {
@@ -753,51 +805,36 @@ namespace cda {
                     return new_matrix;
                 }
                 
-                Matrix<value_type>& operator*=(const value_type &value) {
-                    for (auto it = begin(); it != end(); ++it) {
-                        *it *= value;
-                    }
+                Matrix& operator*=(const value_type &value) {
+                    const auto it = begin();
+                    parallel::parallel_for(0, mat_size, [&](const size_t &from, const size_t &to) {
+                        for (size_t i = from; i < to; ++i) {
+                            it[i] *= value;
+                        }
+                    });
                     return *this;
                 }
                 
-                Matrix<value_type> operator/(const value_type &value) const {
-                    Matrix<value_type> new_matrix(this->n, this->m);
-                    auto it_new = new_matrix.begin();
-                    
-                    for (auto it_this = this->begin(); it_this != this->end(); ++it_this, ++it_new) {
-                        *it_new = *it_this / value;
-                    }
-                    
-                    return new_matrix;
-                }
-                
-                Matrix<value_type>& operator/=(const value_type &value) {
-                    for (auto it = begin(); it != end(); ++it) {
-                        *it /= value;
-                    }
+                Matrix& operator/=(const value_type &value) {
+                    const auto it = begin();
+                    parallel::parallel_for(0, mat_size, [&](const size_t &from, const size_t &to) {
+                        for (size_t i = from; i < to; ++i) {
+                            it[i] /= value;
+                        }
+                    });
                     return *this;
                 }
                 
-                Matrix<value_type> operator-() const {
-                    Matrix<value_type> new_matrix(this->n, this->m);
-                    std::transform(this->begin(), this->end(), new_matrix.begin(),
-                                   [](const value_type &value) {
-                                       return -value;
-                                   });
-                    
-                    return new_matrix;
-                }
-                
                 value_type determinant() const {
                     return algorithms::factorization::LU<Matrix, lu_value_type>::determinant(*this);
                 }
                 
-                Matrix<value_type> pow(const ssize_t &power) const {
+                Matrix pow(const ssize_t &power) const {
                     if (!this->is_square()) {
                         throw std::logic_error("Matrix must be an square matrix");
                     }
                     
-                    Matrix<value_type> new_matrix;
+                    Matrix new_matrix;
                     
                     switch (power) {
                         case -1:
@@ -823,16 +860,16 @@ namespace cda {
                 }
                 
                 //  --- STATIC METHODS ---
-                static Matrix<value_type> zero(const size_t &rows, const size_t &columns) {
-                    return Matrix<value_type>(rows, columns, 0);
+                static Matrix zero(const size_t &rows, const size_t &columns) {
+                    return Matrix(rows, columns, 0);
                 }
                 
-                static Matrix<value_type> ones(const size_t &rows, const size_t &columns) {
-                    return Matrix<value_type>(rows, columns, 1);
+                static Matrix ones(const size_t &rows, const size_t &columns) {
+                    return Matrix(rows, columns, 1);
                 }
                 
-                static Matrix<value_type> identity(const size_t &rows) {
-                    Matrix<value_type> identity(rows, rows);
+                static Matrix identity(const size_t &rows) {
+                    Matrix identity(rows, rows);
                     identity.identity();
                     return identity;
                 }
@@ -840,9 +877,9 @@ namespace cda {
             };
             
             //  MARK: - Extra funcions
-            template <typename ValueType>
-            Matrix<ValueType> transpose(const Vector<ValueType> &vector) {
-                Matrix<ValueType> matrix(vector.size(), 1);
+            template <typename ValueType, typename Allocator>
+            Matrix<ValueType, Allocator> transpose(const Vector<ValueType, Allocator> &vector) {
+                Matrix<ValueType, Allocator> matrix(vector.size(), 1);
                 std::copy(vector.begin(), vector.end(), matrix.begin());
                 return matrix;
             }
@@ -852,23 +889,9 @@ namespace cda {
 } /* namespace cda */
 
 //  MARK: - Extra operators
-template <typename ValueType>
-cda::math::containers::Matrix<ValueType> operator*(const ValueType &value,
-                                           const cda::math::containers::Matrix<ValueType> &matrix) {
-    
-    cda::math::containers::Matrix<ValueType> tmp(matrix.rows(), matrix.columns());
-    auto it_tmp = tmp.begin();
-    
-    for (auto it_matrix = matrix.begin(); it_matrix != matrix.end(); ++it_matrix, ++it_tmp) {
-        *it_tmp = *it_matrix * value;
-    }
-    
-    return tmp;
-}
-
-template <typename ValueType>
-cda::math::containers::Vector<ValueType> operator*(const cda::math::containers::Vector<ValueType> &vector,
-                                           const cda::math::containers::Matrix<ValueType> &matrix) {
+template <typename ValueType, typename VectorAllocator, typename MatrixAllocator>
+cda::math::containers::Vector<ValueType, VectorAllocator> operator*(const cda::math::containers::Vector<ValueType, VectorAllocator> &vector,
+                                                            const cda::math::containers::Matrix<ValueType, MatrixAllocator> &matrix) {
     
     const auto &rows = matrix.rows();
     if (rows != vector.size()) {
@@ -876,37 +899,33 @@ cda::math::containers::Vector<ValueType> operator*(const cda::math::containers::
     }
     
     const auto &columns = matrix.columns();
-    cda::math::containers::Vector<ValueType> new_vector(columns, 0);
-    
-    auto it_new = new_vector.begin();
-    for (size_t column = 0; column < columns; ++column, ++it_new) {
-        auto it_vector = vector.begin();
-        for (size_t row = 0; row < rows; ++row, ++it_vector) {
-            *it_new += *it_vector * matrix[row][column];
-        }
-    }
+    cda::math::containers::Vector<ValueType, VectorAllocator> new_vector(columns, 0);
+    cda::math::algorithms::products::gemm(size_t(1), columns, rows,
+                                          vector.begin(), rows,
+                                          matrix.begin(), columns,
+                                          new_vector.begin(), columns);
     
     return new_vector;
 }
 
-template <typename ValueType>
-cda::math::containers::Matrix<ValueType> operator&&(const cda::math::containers::Matrix<ValueType> &left_matrix,
-                                            const cda::math::containers::Matrix<ValueType> &right_matrix) {
+template <typename ValueType, typename Allocator>
+cda::math::containers::Matrix<ValueType, Allocator> operator&&(const cda::math::containers::Matrix<ValueType, Allocator> &left_matrix,
+                                                       const cda::math::containers::Matrix<ValueType, Allocator> &right_matrix) {
     
     if (left_matrix.rows() != right_matrix.rows()) {
         throw std::logic_error("Both matrices must have the same number of rows");
     }
     
-    cda::math::containers::Matrix<ValueType> new_matrix(left_matrix.rows(), left_matrix.columns() + right_matrix.columns());
+    cda::math::containers::Matrix<ValueType, Allocator> new_matrix(left_matrix.rows(), left_matrix.columns() + right_matrix.columns());
     new_matrix.set_matrix(0, 0, left_matrix);
     new_matrix.set_matrix(0, left_matrix.columns(), right_matrix);
     
     return new_matrix;
 }
 
-template <typename ValueType>
-void operator||(cda::math::containers::Matrix<ValueType> &left_matrix,
-                cda::math::containers::Matrix<ValueType> &right_matrix) {
+template <typename ValueType, typename Allocator>
+void operator||(cda::math::containers::Matrix<ValueType, Allocator> &left_matrix,
+                cda::math::containers::Matrix<ValueType, Allocator> &right_matrix) {
     
     const size_t left_matrix_columns = left_matrix.columns() / 2;
     
@@ -914,9 +933,9 @@ void operator||(cda::math::containers::Matrix<ValueType> &left_matrix,
     left_matrix.resize(left_matrix.rows(), left_matrix_columns);
 }
 
-template <typename ValueType>
+template <typename ValueType, typename Allocator>
 void operator>>(std::istream &input,
-                cda::math::containers::Matrix<ValueType> &matrix) {
+                cda::math::containers::Matrix<ValueType, Allocator> &matrix) {
     
     if (!input) {
         throw std::logic_error("Input is not avaiable");
@@ -965,9 +984,9 @@ void operator>>(std::istream &input,
     matrix.dimensions(rows, columns);
 }
 
-template <typename ValueType>
+template <typename ValueType, typename Allocator>
 std::ostream& operator<<(std::ostream &output,
-                         const cda::math::containers::Matrix<ValueType> &matrix) {
+                         const cda::math::containers::Matrix<ValueType, Allocator> &matrix) {
     
     const size_t rows = matrix.rows();
     const size_t columns = matrix.columns();
@@ -15,37 +15,44 @@
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 
 #include "../algorithms/find.hpp"
+#include "../parallel/thread_pool.hpp"
+#include "expressions.hpp"
+#include "views.hpp"
 
 
 namespace cda {
     namespace math {
         namespace containers {
     
-            template <typename T>
-            class Vector {
+            template <typename T, typename Allocator>
+            class Vector : public expressions::Expression<expressions::VectorTag> {
             private:
                 size_t n;
                 T *v, *it_end;
                 
+                //  Keeps the first min(n, size) elements, n must still hold the current size
                 void alloc_memory(const size_t &size) {
-                    if (size == 0) {
-                        std::free(v);
-                        v = it_end = nullptr;
-                    } else {
-                        if (void *mem = std::realloc(v, size * sizeof(T))) {
-                            v = static_cast<T *>(mem);
-                            it_end = v + size;
-                        } else {
-                            throw std::bad_alloc();
+                    v = memory::reallocate(Allocator(), v, v ? n : 0, size);
+                    it_end = v ? v + size : nullptr;
+                }
+                
+                template <typename Expression>
+                void evaluate(const Expression &expression) {
+                    const auto it = this->begin();
+                    parallel::parallel_for(0, n, [&](const size_t &from, const size_t &to) {
+                        for (size_t i = from; i < to; ++i) {
+                            it[i] = expression.element(i);
                         }
-                    }
+                    });
                 }
                 
             public:
                 
                 typedef T value_type;
+                typedef Allocator allocator_type;
                 
                 /**
                  Class constructor
@@ -73,7 +80,7 @@ namespace cda {
                  
                  @param vector The source vector
                  */
-                Vector(const Vector<value_type> &vector) :
+                Vector(const Vector &vector) :
                 n(vector.n), v(nullptr), it_end(nullptr) {
                     alloc_memory(n);
                     std::copy(vector.begin(), vector.end(), this->begin());
@@ -84,12 +91,25 @@ namespace cda {
                  
                  @param vector The source vector
                  */
-                Vector(Vector<value_type> &&vector) :
+                Vector(Vector &&vector) :
                 n(vector.n), v(vector.v), it_end(vector.it_end) {
                     vector.n = 0;
                     vector.v = vector.it_end = nullptr;
                 }
                 
+                /**
+                 Evaluates an element-wise expression
+                 
+                 @param expression The source expression
+                 */
+                template <typename Expression,
+                          typename = typename std::enable_if<expressions::is_node<Expression, expressions::VectorTag>::value>::type>
+                Vector(const Expression &expression) :
+                n(expression.size()), v(nullptr), it_end(nullptr) {
+                    alloc_memory(n);
+                    evaluate(expression);
+                }
+                
                 template <size_t size>
                 Vector(const value_type (& values)[size]) :
                 n(size), v(nullptr), it_end(nullptr) {
@@ -108,7 +128,7 @@ namespace cda {
                  */
                 ~Vector() {
                     if (v) {
-                        std::free(v);
+                        Allocator().deallocate(v, n);
                         v = it_end = nullptr;
                         n = 0;
                     }
@@ -122,6 +142,10 @@ namespace cda {
                     return it_end;
                 }
                 
+                const value_type &element(const size_t &index) const {
+                    return v[index];
+                }
+                
                 /**
                  Change the size of the vector
                  
@@ -142,7 +166,7 @@ namespace cda {
                     n = size;
                 }
                 
-                Vector<value_type> &operator=(const Vector<value_type> &vector) {
+                Vector &operator=(const Vector &vector) {
                     if (this != &vector) {
                         resize(vector.n, false);
                         std::copy(vector.begin(), vector.end(), this->begin());
@@ -150,9 +174,11 @@ namespace cda {
                     return *this;
                 }
                 
-                Vector<value_type> &operator=(Vector<value_type> &&vector) {
+                Vector &operator=(Vector &&vector) {
                     if (this != &vector) {
-                        std::free(v);
+                        if (v) {
+                            Allocator().deallocate(v, n);
+                        }
                         v = vector.v;
                         it_end = vector.it_end;
                         n = vector.n;
@@ -163,12 +189,20 @@ namespace cda {
                     return *this;
                 }
                 
+                template <typename Expression,
+                          typename = typename std::enable_if<expressions::is_node<Expression, expressions::VectorTag>::value>::type>
+                Vector &operator=(const Expression &expression) {
+                    resize(expression.size(), false);
+                    evaluate(expression);
+                    return *this;
+                }
+                
                 void copy(const size_t &size, const value_type* const array) {
                     resize(size);
                     std::copy(array, array + size, v);
                 }
                 
-                bool operator==(const Vector<value_type> &vector) const {
+                bool operator==(const Vector &vector) const {
                     if (this->n != vector.n) {
                         return false;
                     }
@@ -183,7 +217,7 @@ namespace cda {
                     return true;
                 }
                 
-                bool operator!=(const Vector<value_type> &vector) const {
+                bool operator!=(const Vector &vector) const {
                     return !this->operator==(vector);
                 }
                 
@@ -195,7 +229,7 @@ namespace cda {
                  
                  @return A vector with size \p elements and the values starting from \p first_element
                  */
-                Vector<value_type> get(const size_t &first_element, const size_t &elements) const {
+                Vector get(const size_t &first_element, const size_t &elements) const {
                     if (n - first_element < elements) {
                         throw std::out_of_range("There are not enough elements inside the vector");
                     }
@@ -203,7 +237,7 @@ namespace cda {
                     auto it_begin = v + first_element;
                     auto it_end = it_begin + elements;
                     
-                    return Vector<value_type>(it_begin, it_end);
+                    return Vector(it_begin, it_end);
                 }
                 
                 /**
@@ -213,10 +247,38 @@ namespace cda {
                  
                  @return A vector with all values starting from \p first_element
                  */
-                Vector<value_type> get(const size_t &first_element) const {
+                Vector get(const size_t &first_element) const {
                     return get(first_element, n - first_element);
                 }
                 
+                /**
+                 Returns a view of the elements in [\p from, \p to) without copying them.
+                 The view is valid while the vector is not resized.
+                 
+                 @param from The position of the first element of the view
+                 @param to The position after the last element of the view
+                 
+                 @return A view sharing the elements of this vector
+                 */
+                VectorView<value_type> view(const size_t &from, const size_t &to) {
+                    if (from > to || to > n) {
+                        throw std::out_of_range("Index out of bounds");
+                    }
+                    return VectorView<value_type>(v + from, to - from);
+                }
+                
+                VectorView<const value_type> view(const size_t &from, const size_t &to) const {
+                    return const_cast<Vector *>(this)->view(from, to);
+                }
+                
+                VectorView<value_type> view() {
+                    return view(0, n);
+                }
+                
+                VectorView<const value_type> view() const {
+                    return view(0, n);
+                }
+                
                 /**
                  Copy \p elements from \p vector starting at position \p first_element
                  
@@ -224,7 +286,7 @@ namespace cda {
                  @param vector The vector with the elements to be copied
                  @param elements The number of elements to copy
                  */
-                void set(const size_t &first_element, const Vector<value_type> &vector, const size_t &elements) {
+                void set(const size_t &first_element, const Vector &vector, const size_t &elements) {
                     if (first_element + elements > n || elements > vector.n) {
                         throw std::out_of_range("Out of bounds");
                     }
@@ -237,7 +299,7 @@ namespace cda {
                  @param first_element The position of the first element to be copied
                  @param vector The vector to copy
                  */
-                void set(const size_t &first_element, const Vector<value_type> &vector) {
+                void set(const size_t &first_element, const Vector &vector) {
                     set(first_element, vector, vector.n);
                 }
                 
@@ -312,7 +374,7 @@ namespace cda {
                  
                  @return The normalized vector
                  */
-                Vector<value_type> normalized_vector() const {
+                Vector normalized_vector() const {
                     return (* this) / norm();
                 }
                 
@@ -327,24 +389,24 @@ namespace cda {
                     std::fill(begin(), end(), value);
                 }
                 
-                static Vector<value_type> zero(const size_t &size) {
-                    return Vector<value_type>(size, 0);
+                static Vector zero(const size_t &size) {
+                    return Vector(size, 0);
                 }
                 
                 void zero() {
                     fill(0);
                 }
                 
-                static Vector<value_type> ones(const size_t &size) {
-                    return Vector<value_type>(size, 1);
+                static Vector ones(const size_t &size) {
+                    return Vector(size, 1);
                 }
                 
                 void ones() {
                     fill(1);
                 }
                 
-                static Vector<value_type> random(const size_t &size, const value_type &min, const value_type &max) {
-                    Vector<value_type> _random(size);
+                static Vector random(const size_t &size, const value_type &min, const value_type &max) {
+                    Vector _random(size);
                     _random.random(min, max);
                     return _random;
                 }
@@ -356,8 +418,17 @@ namespace cda {
                 }
                 
                 void clear() {
+                    alloc_memory(0);
                     n = 0;
-                    alloc_memory(n);
+                }
+                
+                /**
+                 Exchanges the contents of two vectors without copying nor allocating
+                 */
+                void swap(Vector &vector) noexcept {
+                    std::swap(n, vector.n);
+                    std::swap(v, vector.v);
+                    std::swap(it_end, vector.it_end);
                 }
                 
                 bool is_empty() const {
@@ -404,106 +475,62 @@ namespace cda {
                 }
                 
                 //  --- OPERATORS ---
-                Vector<value_type> operator+(const Vector<value_type> &vector) const {
-                    if (this->n != vector.n) {
-                        throw std::logic_error("Unable to sum two vector of different size");
-                    }
-                    
-                    Vector<value_type> new_vector(this->n);
-                    
-                    auto it_new = new_vector.begin();
-                    auto it_vector = vector.begin();
-                    for (auto it_this = this->begin(); it_this != this->end(); ++it_this, ++it_vector, ++it_new) {
-                        *it_new = *it_this + *it_vector;
-                    }
+                template <typename Expression,
+                          typename = typename std::enable_if<expressions::is_expression<Expression, expressions::VectorTag>::value>::type>
+                Vector &operator+=(const Expression &expression) {
+                    expressions::VectorTag::check_dimensions(*this, expression);
                     
-                    return new_vector;
-                }
-                
-                Vector<value_type> &operator+=(const Vector<value_type> &vector) {
-                    if (this->n != vector.n) {
-                        throw std::logic_error("Unable to sum two vector of different size");
-                    }
-                    
-                    auto it_vector = vector.begin();
-                    for (auto it_this = this->begin(); it_this != this->end(); ++it_this, ++it_vector) {
-                        *it_this += *it_vector;
-                    }
+                    const auto it_this = this->begin();
+                    parallel::parallel_for(0, n, [&](const size_t &from, const size_t &to) {
+                        for (size_t i = from; i < to; ++i) {
+                            it_this[i] += expression.element(i);
+                        }
+                    });
                     
                     return *this;
                 }
                 
-                Vector<value_type> operator-(const Vector<value_type> &vector) const {
-                    if (this->n != vector.n) {
-                        throw std::logic_error("Unable to sum two vector of different sizes");
-                    }
-                    
-                    Vector<value_type> new_vector(this->n);
-                    
-                    auto it_new = new_vector.begin();
-                    auto it_vector = vector.begin();
-                    for (auto it_this = this->begin(); it_this != this->end(); ++it_this, ++it_vector, ++it_new) {
-                        *it_new = *it_this - *it_vector;
-                    }
-                    
-                    return new_vector;
-                }
-                
-                Vector<value_type> &operator-=(const Vector<value_type> &vector) {
-                    if (this->n != vector.n) {
-                        throw std::logic_error("Unable to sum two vector of different size");
-                    }
+                template <typename Expression,
+                          typename = typename std::enable_if<expressions::is_expression<Expression, expressions::VectorTag>::value>::type>
+                Vector &operator-=(const Expression &expression) {
+                    expressions::VectorTag::check_dimensions(*this, expression);
                     
-                    auto it_vector = vector.begin();
-                    for (auto it_this = this->begin(); it_this != this->end(); ++it_this, ++it_vector) {
-                        *it_this -= *it_vector;
-                    }
+                    const auto it_this = this->begin();
+                    parallel::parallel_for(0, n, [&](const size_t &from, const size_t &to) {
+                        for (size_t i = from; i < to; ++i) {
+                            it_this[i] -= expression.element(i);
+                        }
+                    });
                     
                     return *this;
                 }
                 
-                Vector<value_type> operator*(const value_type &value) const {
-                    Vector<value_type> new_vector(this->n);
-                    auto it_new = new_vector.begin();
-                    
-                    for (auto it_this = this->begin(); it_this != this->end(); ++it_this, ++it_new) {
-                        *it_new = *it_this * value;
-                    }
-                    
-                    return new_vector;
-                }
-                
-                Vector<value_type> &operator*=(const value_type &value) {
-                    for (auto it = this->begin(); it != this->end(); ++it) {
-                        *it *= value;
-                    }
+                Vector &operator*=(const value_type &value) {
+                    const auto it = this->begin();
+                    parallel::parallel_for(0, n, [&](const size_t &from, const size_t &to) {
+                        for (size_t i = from; i < to; ++i) {
+                            it[i] *= value;
+                        }
+                    });
                     return *this;
                 }
                 
-                Vector<value_type> operator/(const value_type &value) const {
-                    Vector<value_type> new_vector(this->n);
-                    auto it_new = new_vector.begin();
-                    
-                    for (auto it = this->begin(); it != this->end(); ++it, ++it_new) {
-                        *it_new = *it / value;
-                    }
-                    
-                    return new_vector;
-                }
-                
-                Vector<value_type> &operator/=(const value_type &value) {
-                    for (auto it = this->begin(); it != this->end(); ++it) {
-                        *it /= value;
-                    }
+                Vector &operator/=(const value_type &value) {
+                    const auto it = this->begin();
+                    parallel::parallel_for(0, n, [&](const size_t &from, const size_t &to) {
+                        for (size_t i = from; i < to; ++i) {
+                            it[i] /= value;
+                        }
+                    });
                     return *this;
                 }
                 
-                Vector<value_type> pow(const size_t &power) const {
-                    Vector<value_type> new_vector;
+                Vector pow(const size_t &power) const {
+                    Vector new_vector;
                     
                     switch (power) {
                         case 0:
-                            new_vector = Vector<value_type>::ones(this->n);
+                            new_vector = Vector::ones(this->n);
                             break;
                         
                         default:
@@ -521,8 +548,8 @@ namespace cda {
                     return new_vector;
                 }
                 
-                Vector<value_type> sqrt() const {
-                    Vector<value_type> new_vector(this->n);
+                Vector sqrt() const {
+                    Vector new_vector(this->n);
                     auto it_new_vector = new_vector.begin();
                     for (auto it_this = this->begin(); it_this != this->end(); ++it_this) {
                         *it_new_vector++ = std::sqrt(*it_this);
@@ -532,8 +559,8 @@ namespace cda {
                 
                 template<typename Integer,
                          typename = std::enable_if<std::is_integral<Integer>::value>>
-                Vector<value_type> operator%(const Integer &value) const {
-                    Vector<value_type> new_vector(this->n);
+                Vector operator%(const Integer &value) const {
+                    Vector new_vector(this->n);
                     auto it_new = new_vector.begin();
                     
                     for (auto it = this->begin(); it != this->end(); ++it, ++it_new) {
@@ -545,30 +572,19 @@ namespace cda {
                 
                 template<typename Integer,
                          typename = std::enable_if<std::is_integral<Integer>::value>>
-                Vector<value_type> &operator%=(const Integer& value) {
+                Vector &operator%=(const Integer& value) {
                     for (auto it = this->begin(); it != this->end(); ++it) {
                         *it = static_cast<Integer>(*it) % value;
                     }
                     return *this;
                 }
                 
-                Vector<value_type> operator-() const {
-                    Vector<value_type> new_vector(this->n);
-                    auto it_new = new_vector.begin();
-                    
-                    for (auto it = this->begin(); it != this->end(); ++it) {
-                        *it_new++ = -(*it);
-                    }
-                    
-                    return new_vector;
-                }
-                
-                Vector<value_type> cross_product(const Vector<value_type> &vector) const {
+                Vector cross_product(const Vector &vector) const {
                     if (this->n != vector.n || this->n != 3) {
                         throw std::logic_error("Both vectors must be of the same size, and size must be 3");
                     }
                     
-                    Vector<value_type> new_vector(this->n);
+                    Vector new_vector(this->n);
                     new_vector[0] = this->operator[](1) * vector[2] - this->operator[](2) * vector[1];
                     new_vector[1] = this->operator[](2) * vector[0] - this->operator[](0) * vector[2];
                     new_vector[2] = this->operator[](0) * vector[1] - this->operator[](1) * vector[0];
@@ -576,7 +592,7 @@ namespace cda {
                     return new_vector;
                 }
                 
-                value_type operator*(const Vector<value_type> &vector) const {
+                value_type operator*(const Vector &vector) const {
                     if (this->n != vector.n) {
                         throw std::logic_error("Both vectors must be of the same size");
                     }
@@ -598,22 +614,9 @@ namespace cda {
 } /* namespace containers */
 
 //  --- MORE OPERATORS ---
-template <typename ValueType, typename T2>
-cda::math::containers::Vector<ValueType> operator*(const T2 &value, const cda::math::containers::Vector<ValueType> &vector) {
-    
-    cda::math::containers::Vector<ValueType> new_vector(vector.size());
-    auto it_new = new_vector.begin();
-    
-    for (auto it = vector.begin(); it != vector.end(); ++it, ++it_new) {
-        *it_new = *it * static_cast<ValueType>(value);
-    }
-    
-    return new_vector;
-}
-
-template <typename ValueType>
+template <typename ValueType, typename Allocator>
 void operator>>(std::istream &input,
-                cda::math::containers::Vector<ValueType> &vector) {
+                cda::math::containers::Vector<ValueType, Allocator> &vector) {
     
     if (!input) {
         throw std::logic_error("Input is not avaiable");
@@ -642,9 +645,9 @@ void operator>>(std::istream &input,
     vector.resize(element);
 }
 
-template <typename ValueType>
+template <typename ValueType, typename Allocator>
 std::ostream& operator<<(std::ostream &output,
-                         const cda::math::containers::Vector<ValueType> &vector) {
+                         const cda::math::containers::Vector<ValueType, Allocator> &vector) {
     
     if (output.rdbuf() == std::cout.rdbuf()) {
         
@@ -0,0 +1,323 @@
+//
+//  views.hpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include "expressions.hpp"
+
+
+namespace cda {
+    namespace math {
+        namespace containers {
+
+            /**
+             Random access iterator jumping a fixed number of elements
+             */
+            template <typename T>
+            class StridedIterator {
+            private:
+                T *it;
+                std::ptrdiff_t step;
+
+            public:
+                typedef std::random_access_iterator_tag iterator_category;
+                typedef typename std::remove_const<T>::type value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef T *pointer;
+                typedef T &reference;
+
+                StridedIterator(T *it = nullptr, const std::ptrdiff_t &step = 1) : it(it), step(step) {
+                }
+
+                reference operator*() const { return *it; }
+                pointer operator->() const { return it; }
+                reference operator[](const difference_type &offset) const { return it[offset * step]; }
+
+                StridedIterator &operator++() { it += step; return *this; }
+                StridedIterator &operator--() { it -= step; return *this; }
+                StridedIterator operator++(int) { StridedIterator tmp(*this); it += step; return tmp; }
+                StridedIterator operator--(int) { StridedIterator tmp(*this); it -= step; return tmp; }
+
+                StridedIterator &operator+=(const difference_type &offset) { it += offset * step; return *this; }
+                StridedIterator &operator-=(const difference_type &offset) { it -= offset * step; return *this; }
+                StridedIterator operator+(const difference_type &offset) const { return StridedIterator(it + offset * step, step); }
+                StridedIterator operator-(const difference_type &offset) const { return StridedIterator(it - offset * step, step); }
+                difference_type operator-(const StridedIterator &other) const { return (it - other.it) / step; }
+
+                bool operator==(const StridedIterator &other) const { return it == other.it; }
+                bool operator!=(const StridedIterator &other) const { return it != other.it; }
+                bool operator<(const StridedIterator &other) const { return step > 0 ? it < other.it : it > other.it; }
+                bool operator>(const StridedIterator &other) const { return other < *this; }
+                bool operator<=(const StridedIterator &other) const { return !(other < *this); }
+                bool operator>=(const StridedIterator &other) const { return !(*this < other); }
+            };
+
+            /**
+             Non-owning view over equally spaced elements: a vector, a row, a column
+             or a diagonal of a matrix. T may be const qualified for read-only views.
+             */
+            template <typename T>
+            class VectorView : public expressions::Expression<expressions::VectorTag> {
+            private:
+                T *data;
+                size_t n;
+                std::ptrdiff_t step;
+
+                template <typename Expression, typename Operation>
+                VectorView &update(const Expression &expression, const Operation &operation) {
+                    expressions::VectorTag::check_dimensions(*this, expression);
+                    for (size_t i = 0; i < n; ++i) {
+                        operation(data[i * step], expression.element(i));
+                    }
+                    return *this;
+                }
+
+            public:
+                typedef typename std::remove_const<T>::type value_type;
+                typedef StridedIterator<T> iterator;
+
+                VectorView(T *data, const size_t &size, const std::ptrdiff_t &stride = 1) :
+                data(data), n(size), step(stride) {
+                }
+
+                VectorView(const VectorView &view) = default;
+
+                //  Read-only view of a mutable one
+                template <typename U,
+                          typename = typename std::enable_if<std::is_same<const U, T>::value>::type>
+                VectorView(const VectorView<U> &view) :
+                data(view.begin().operator->()), n(view.size()), step(view.stride()) {
+                }
+
+                size_t size() const { return n; }
+                std::ptrdiff_t stride() const { return step; }
+                bool is_empty() const { return n == 0; }
+
+                iterator begin() const { return iterator(data, step); }
+                iterator end() const { return iterator(data + static_cast<std::ptrdiff_t>(n) * step, step); }
+
+                T &operator[](const size_t &index) const { return data[index * step]; }
+                const value_type &element(const size_t &index) const { return data[index * step]; }
+
+                T &at(const size_t &index) const {
+                    if (index >= n) {
+                        throw std::out_of_range("Index out of bounds");
+                    }
+                    return data[index * step];
+                }
+
+                VectorView view(const size_t &from, const size_t &to) const {
+                    if (from > to || to > n) {
+                        throw std::out_of_range("Index out of bounds");
+                    }
+                    return VectorView(data + static_cast<std::ptrdiff_t>(from) * step, to - from, step);
+                }
+
+                //  Assignments write through the view
+                VectorView &operator=(const VectorView &view) {
+                    return update(view, [](value_type &element, const value_type &value) { element = value; });
+                }
+
+                template <typename Expression,
+                          typename = typename std::enable_if<expressions::is_expression<Expression, expressions::VectorTag>::value>::type>
+                VectorView &operator=(const Expression &expression) {
+                    return update(expression, [](value_type &element, const value_type &value) { element = value; });
+                }
+
+                template <typename Expression,
+                          typename = typename std::enable_if<expressions::is_expression<Expression, expressions::VectorTag>::value>::type>
+                VectorView &operator+=(const Expression &expression) {
+                    return update(expression, [](value_type &element, const value_type &value) { element += value; });
+                }
+
+                template <typename Expression,
+                          typename = typename std::enable_if<expressions::is_expression<Expression, expressions::VectorTag>::value>::type>
+                VectorView &operator-=(const Expression &expression) {
+                    return update(expression, [](value_type &element, const value_type &value) { element -= value; });
+                }
+
+                VectorView &operator*=(const value_type &value) {
+                    for (size_t i = 0; i < n; ++i) {
+                        data[i * step] *= value;
+                    }
+                    return *this;
+                }
+
+                VectorView &operator/=(const value_type &value) {
+                    for (size_t i = 0; i < n; ++i) {
+                        data[i * step] /= value;
+                    }
+                    return *this;
+                }
+
+                void fill(const value_type &value) const {
+                    for (size_t i = 0; i < n; ++i) {
+                        data[i * step] = value;
+                    }
+                }
+
+                bool is_null() const {
+                    for (size_t i = 0; i < n; ++i) {
+                        if (data[i * step] != 0) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+            };
+
+            /**
+             Non-owning view over a block of a matrix. Rows and columns may have any stride,
+             so transposed blocks are views too.
+             */
+            template <typename T>
+            class MatrixView : public expressions::Expression<expressions::MatrixTag> {
+            private:
+                T *data;
+                size_t n, m;
+                std::ptrdiff_t row_step, column_step;
+
+                template <typename Expression, typename Operation>
+                MatrixView &update(const Expression &expression, const Operation &operation) {
+                    expressions::MatrixTag::check_dimensions(*this, expression);
+                    size_t index = 0;
+                    for (size_t row = 0; row < n; ++row) {
+                        T *it = data + static_cast<std::ptrdiff_t>(row) * row_step;
+                        for (size_t column = 0; column < m; ++column, ++index, it += column_step) {
+                            operation(*it, expression.element(index));
+                        }
+                    }
+                    return *this;
+                }
+
+            public:
+                typedef typename std::remove_const<T>::type value_type;
+
+                MatrixView(T *data, const size_t &rows, const size_t &columns,
+                           const std::ptrdiff_t &row_stride, const std::ptrdiff_t &column_stride = 1) :
+                data(data), n(rows), m(columns), row_step(row_stride), column_step(column_stride) {
+                }
+
+                MatrixView(const MatrixView &view) = default;
+
+                size_t rows() const { return n; }
+                size_t columns() const { return m; }
+                size_t size() const { return n * m; }
+                std::ptrdiff_t row_stride() const { return row_step; }
+                std::ptrdiff_t column_stride() const { return column_step; }
+                bool is_square() const { return n == m; }
+
+                T &operator()(const size_t &row, const size_t &column) const {
+                    return data[static_cast<std::ptrdiff_t>(row) * row_step + static_cast<std::ptrdiff_t>(column) * column_step];
+                }
+
+                VectorView<T> operator[](const size_t &row) const {
+                    return this->row(row);
+                }
+
+                const value_type &element(const size_t &index) const {
+                    return this->operator()(index / m, index % m);
+                }
+
+                VectorView<T> row(const size_t &row, const size_t &from_column = 0) const {
+                    if (row >= n || from_column > m) {
+                        throw std::out_of_range("Index out of bounds");
+                    }
+                    return VectorView<T>(&this->operator()(row, from_column), m - from_column, column_step);
+                }
+
+                VectorView<T> column(const size_t &column, const size_t &from_row = 0) const {
+                    if (column >= m || from_row > n) {
+                        throw std::out_of_range("Index out of bounds");
+                    }
+                    return VectorView<T>(&this->operator()(from_row, column), n - from_row, row_step);
+                }
+
+                VectorView<T> diagonal() const {
+                    return VectorView<T>(data, std::min(n, m), row_step + column_step);
+                }
+
+                MatrixView block(const size_t &row, const size_t &column,
+                                 const size_t &number_of_rows, const size_t &number_of_columns) const {
+                    if (row + number_of_rows > n || column + number_of_columns > m) {
+                        throw std::out_of_range("Index out of bounds");
+                    }
+                    return MatrixView(&this->operator()(row, column), number_of_rows, number_of_columns, row_step, column_step);
+                }
+
+                MatrixView transpose() const {
+                    return MatrixView(data, m, n, column_step, row_step);
+                }
+
+                //  Assignments write through the view
+                MatrixView &operator=(const MatrixView &view) {
+                    return update(view, [](value_type &element, const value_type &value) { element = value; });
+                }
+
+                template <typename Expression,
+                          typename = typename std::enable_if<expressions::is_expression<Expression, expressions::MatrixTag>::value>::type>
+                MatrixView &operator=(const Expression &expression) {
+                    return update(expression, [](value_type &element, const value_type &value) { element = value; });
+                }
+
+                template <typename Expression,
+                          typename = typename std::enable_if<expressions::is_expression<Expression, expressions::MatrixTag>::value>::type>
+                MatrixView &operator+=(const Expression &expression) {
+                    return update(expression, [](value_type &element, const value_type &value) { element += value; });
+                }
+
+                template <typename Expression,
+                          typename = typename std::enable_if<expressions::is_expression<Expression, expressions::MatrixTag>::value>::type>
+                MatrixView &operator-=(const Expression &expression) {
+                    return update(expression, [](value_type &element, const value_type &value) { element -= value; });
+                }
+
+                void fill(const value_type &value) const {
+                    for (size_t row = 0; row < n; ++row) {
+                        this->row(row).fill(value);
+                    }
+                }
+            };
+
+            //  --- VIEW ALGORITHMS ---
+            //  Accept Vector, VectorView and element-wise expressions alike
+
+            template <typename Left, typename Right,
+                      typename = typename std::enable_if<expressions::are_expressions<Left, Right, expressions::VectorTag>::value>::type>
+            expressions::value_of<Left> dot(const Left &left, const Right &right) {
+                expressions::VectorTag::check_dimensions(left, right);
+
+                expressions::value_of<Left> value(0);
+                for (size_t i = 0; i < left.size(); ++i) {
+                    value += left.element(i) * right.element(i);
+                }
+                return value;
+            }
+
+            template <typename E,
+                      typename = typename std::enable_if<expressions::is_expression<E, expressions::VectorTag>::value>::type>
+            expressions::value_of<E> square_norm(const E &vector) {
+                return dot(vector, vector);
+            }
+
+            template <typename E,
+                      typename = typename std::enable_if<expressions::is_expression<E, expressions::VectorTag>::value>::type>
+            double norm(const E &vector) {
+                return std::sqrt(square_norm(vector));
+            }
+
+        } /* namespace containers */
+    } /* namespace math */
+} /* namespace cda */
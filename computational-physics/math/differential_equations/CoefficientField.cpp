@@ -0,0 +1,82 @@
+//
+//  CoefficientField.cpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#include "CoefficientField.h"
+#include "TemporalBlocking.h"
+
+#include <algorithm>
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+template <typename T>
+BasicCoefficientField<T>::BasicCoefficientField() : Q(nullptr), _value(0), uniform(false)
+{
+}
+
+template <typename T>
+void BasicCoefficientField<T>::sample(Function Q, const Vector<EDP_T> &x, const Vector<EDP_T> &y)
+{
+    const size_t n = y.size(), m = x.size();
+
+    this->Q = Q;
+    this->x = x;
+    this->y = y;
+    values.resize(n, m);
+
+    //  Cada fila se muestrea en el hilo que la lee en los solvers (primera escritura en su nodo NUMA)
+    blocking::touch(n, std::max<size_t>(1, n*m / CDA_TEAM_GRAIN), [&](const size_t &lo, const size_t &hi) {
+        for (size_t i = lo; i < hi; ++i) {
+            T *row = values[i];
+            for (size_t j = 0; j < m; ++j) {
+                row[j] = T(Q(x[j], y[i]));
+            }
+        }
+    });
+
+    compress();
+}
+
+template <typename T>
+void BasicCoefficientField<T>::assign(const Matrix<EDP_T> &values)
+{
+    const size_t n = values.rows(), m = values.columns();
+
+    Q = nullptr;
+    this->values.resize(n, m);
+
+    blocking::touch(n, std::max<size_t>(1, n*m / CDA_TEAM_GRAIN), [&](const size_t &lo, const size_t &hi) {
+        for (size_t i = lo; i < hi; ++i) {
+            std::transform(values[i], values[i] + m, this->values[i], [](const EDP_T &q) { return T(q); });
+        }
+    });
+
+    compress();
+}
+
+template <typename T>
+void BasicCoefficientField<T>::compress()
+{
+    _value = !values.is_empty() ? values[0][0] : 0;
+    uniform = std::all_of(values.begin(), values.end(), [this](const T &q) { return q == _value; });
+
+    //  Para un coeficiente constante basta con el valor
+    if (uniform) {
+        values.clear();
+    }
+}
+
+template <typename T>
+bool BasicCoefficientField<T>::samples(Function Q, const Vector<EDP_T> &x, const Vector<EDP_T> &y) const
+{
+    return Q && this->Q == Q && this->x == x && this->y == y;
+}
+
+template class cda::math::differential_equations::BasicCoefficientField<float>;
+template class cda::math::differential_equations::BasicCoefficientField<double>;
@@ -0,0 +1,70 @@
+//
+//  CoefficientField.h
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include "../containers.hpp"
+
+
+namespace cda {
+    namespace math {
+        namespace differential_equations {
+
+            typedef double EDP_T;
+
+            //  -- COEFICIENTE Q(x,y) MUESTREADO EN LA MALLA --
+            //  Evalúa Q una sola vez en cada punto para que los esquemas no tengan que llamar a la función
+            //  en cada paso. Si Q toma el mismo valor en toda la malla sólo se guarda ese valor, y los
+            //  esquemas pueden usar un bucle sin accesos a la malla de coeficientes.
+            //
+            //  Q siempre se evalúa en EDP_T; T es el tipo en el que se guardan los valores (float o double).
+            template <typename T>
+            class BasicCoefficientField {
+            public:
+                typedef EDP_T (* Function)(EDP_T x, EDP_T y);
+
+                BasicCoefficientField();
+
+                //  Evalúa Q en todos los puntos (x[j], y[i])
+                void sample(Function Q, const containers::Vector<EDP_T> &x, const containers::Vector<EDP_T> &y);
+
+                //  Toma valores ya muestreados (p. ej. por otro proceso). samples() no los reconoce
+                void assign(const containers::Matrix<EDP_T> &values);
+
+                //  Indica si el campo se muestreó con la misma función y la misma malla
+                bool samples(Function Q, const containers::Vector<EDP_T> &x, const containers::Vector<EDP_T> &y) const;
+
+                bool is_empty() const { return !Q && !uniform && values.is_empty(); }
+                bool is_uniform() const { return uniform; }
+
+                //  Valor en toda la malla. Sólo tiene sentido si is_uniform()
+                T value() const { return _value; }
+
+                //  Fila i del campo. No disponible si is_uniform()
+                const T *operator[](const size_t &row) const { return values[row]; }
+
+                T operator()(const size_t &row, const size_t &column) const {
+                    return uniform ? _value : values[row][column];
+                }
+
+            private:
+                //  Si todos los valores son iguales sólo guarda uno
+                void compress();
+
+                Function Q;
+                containers::Vector<EDP_T> x, y;
+                containers::Matrix<T> values;
+                T _value;
+                bool uniform;
+            };
+
+            typedef BasicCoefficientField<EDP_T> CoefficientField;
+
+        } /* namespace differential_equations */
+    } /* namespace math */
+} /* namespace cda */
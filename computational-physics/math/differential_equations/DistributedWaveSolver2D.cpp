@@ -0,0 +1,909 @@
+//
+//  DistributedWaveSolver2D.cpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#include "DistributedWaveSolver2D.h"
+#include "WaveSolver2D.h"
+#include "../parallel/team.hpp"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#if defined(__APPLE__)
+#include <crt_externs.h>
+#include <mach-o/dyld.h>
+#else
+extern char **environ;
+#endif
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+namespace {
+
+    enum Order {
+        STEP,
+        LOAD,
+        STORE,
+        FIXED,
+        COEFFICIENTS
+    };
+
+    //  Descriptores de los sockets en los procesos de los rangos
+    enum Descriptor {
+        COORDINATOR = 3,
+        ABOVE = 4,
+        BELOW = 5
+    };
+
+    //  Orden del coordinador. count es el número de pasos de STEP o de filas de LOAD
+    struct Message {
+        uint64_t order, count;
+    };
+
+    //  Primer mensaje del coordinador a un rango, seguido de x, y, cI, cId, fixed y una orden COEFFICIENTS
+    struct Setup {
+        uint32_t value_size, compute_size;  //  Precision del solver
+        uint64_t rows, columns;             //  Filas propias y halos
+        uint64_t top, bottom;               //  Primera y última fila propias
+        unsigned char bc;                   //  Sin BCT_df ni BCB_df en los bordes con vecino
+        bool above, below;                  //  Hay vecino encima (ABOVE) o debajo (BELOW)
+        EDP_T time, dt, dy;
+    };
+
+#if defined(MSG_NOSIGNAL)
+    const int sendFlags = MSG_NOSIGNAL;
+#else
+    const int sendFlags = 0;                //  macOS: SO_NOSIGPIPE en cada socket
+#endif
+
+    //  Filas propias más un halo a cada lado que tenga vecino
+    void halos(const size_t &n, const size_t &lo, const size_t &hi, size_t &first, size_t &last) {
+        first = lo > 0 ? lo - 1 : 0;
+        last = std::min(hi + 1, n);
+    }
+
+    //  Compara bit a bit count valores
+    bool same(const EDP_T *a, const EDP_T *b, const size_t &count) {
+        return count == 0 || std::memcmp(a, b, count * sizeof(EDP_T)) == 0;
+    }
+
+    //  -- SOCKETS --
+
+    void put(const int &fd, const void *data, size_t bytes) {
+        const char *it = static_cast<const char *>(data);
+        while (bytes > 0) {
+            const ssize_t sent = send(fd, it, bytes, sendFlags);
+            if (sent < 0 && errno == EINTR) {
+                continue;
+            }
+            if (sent <= 0) {
+                throw std::runtime_error("Un proceso de DistributedWaveSolver2D ha terminado");
+            }
+            it += sent;
+            bytes -= size_t(sent);
+        }
+    }
+
+    //  false si el otro extremo se ha cerrado antes del primer byte
+    bool receive(const int &fd, void *data, size_t bytes) {
+        char *it = static_cast<char *>(data);
+        const size_t total = bytes;
+        while (bytes > 0) {
+            const ssize_t received = recv(fd, it, bytes, 0);
+            if (received < 0 && errno == EINTR) {
+                continue;
+            }
+            if (received == 0 && bytes == total) {
+                return false;
+            }
+            if (received <= 0) {
+                throw std::runtime_error("Un proceso de DistributedWaveSolver2D ha terminado");
+            }
+            it += received;
+            bytes -= size_t(received);
+        }
+        return true;
+    }
+
+    void get(const int &fd, void *data, const size_t &bytes) {
+        if (!receive(fd, data, bytes)) {
+            throw std::runtime_error("Un proceso de DistributedWaveSolver2D ha terminado");
+        }
+    }
+
+    void put(const int &fd, const Vector<EDP_T> &vector) {
+        const uint64_t size = vector.size();
+        put(fd, &size, sizeof(size));
+        put(fd, vector.begin(), size * sizeof(EDP_T));
+    }
+
+    void get(const int &fd, Vector<EDP_T> &vector) {
+        uint64_t size;
+        get(fd, &size, sizeof(size));
+        vector.resize(size);
+        get(fd, vector.begin(), size * sizeof(EDP_T));
+    }
+
+    //  Las filas viajan siempre en EDP_T. En precisión simple se convierten fila a fila
+    void putRows(const int &fd, const Matrix<EDP_T> &matrix, const size_t &from, const size_t &to) {
+        put(fd, matrix[from], (to - from) * matrix.columns() * sizeof(EDP_T));
+    }
+
+    template <typename T>
+    void putRows(const int &fd, const Matrix<T> &matrix, const size_t &from, const size_t &to) {
+        std::vector<EDP_T> row(matrix.columns());
+        for (size_t i = from; i < to; ++i) {
+            std::copy(matrix[i], matrix[i] + matrix.columns(), row.begin());
+            put(fd, row.data(), row.size() * sizeof(EDP_T));
+        }
+    }
+
+    void getRow(const int &fd, EDP_T *row, const size_t &m) {
+        get(fd, row, m * sizeof(EDP_T));
+    }
+
+    template <typename T>
+    void getRow(const int &fd, T *row, const size_t &m) {
+        std::vector<EDP_T> values(m);
+        get(fd, values.data(), m * sizeof(EDP_T));
+        std::copy(values.begin(), values.end(), row);
+    }
+
+    //  Par de sockets conectados que no heredan los procesos creados, con descriptores mayores que BELOW
+    //  para que posix_spawn pueda colocarlos en COORDINATOR, ABOVE y BELOW sin pisarlos
+    void connect(int fds[2]) {
+#if defined(SOCK_CLOEXEC)
+        if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0) {
+            throw std::runtime_error("No se han podido crear los sockets de DistributedWaveSolver2D");
+        }
+#else
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+            throw std::runtime_error("No se han podido crear los sockets de DistributedWaveSolver2D");
+        }
+        fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+        fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+#endif
+
+        for (size_t k = 0; k < 2; ++k) {
+            if (fds[k] <= BELOW) {
+                const int fd = fcntl(fds[k], F_DUPFD_CLOEXEC, BELOW + 1);
+                close(fds[k]);
+                fds[k] = fd;
+            }
+#if defined(SO_NOSIGPIPE)
+            const int on = 1;
+            setsockopt(fds[k], SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+        }
+
+        if (fds[0] < 0 || fds[1] < 0) {
+            close(fds[0]);
+            close(fds[1]);
+            throw std::runtime_error("No se han podido crear los sockets de DistributedWaveSolver2D");
+        }
+    }
+
+    //  Envía out y recibe in por cada enlace a la vez: ningún rango se queda bloqueado escribiendo
+    //  mientras su vecino también escribe, aunque las filas no quepan en los buffers de los sockets
+    struct Link {
+        int fd;
+        const char *out;
+        char *in;
+        size_t sent, received;
+    };
+
+    void exchange(Link *links, const size_t &count, const size_t &bytes) {
+        while (true) {
+            pollfd fds[2];
+            Link *active[2];
+            size_t k = 0;
+            for (size_t l = 0; l < count; ++l) {
+                const short events = (links[l].sent < bytes ? POLLOUT : 0) | (links[l].received < bytes ? POLLIN : 0);
+                if (events) {
+                    fds[k] = {links[l].fd, events, 0};
+                    active[k++] = &links[l];
+                }
+            }
+            if (k == 0) {
+                return;
+            }
+
+            if (poll(fds, k, -1) < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::runtime_error("Un proceso de DistributedWaveSolver2D ha terminado");
+            }
+
+            for (size_t l = 0; l < k; ++l) {
+                Link &link = *active[l];
+                if (fds[l].revents & POLLOUT) {
+                    const ssize_t sent = send(link.fd, link.out + link.sent, bytes - link.sent, sendFlags);
+                    if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                        throw std::runtime_error("Un proceso de DistributedWaveSolver2D ha terminado");
+                    }
+                    link.sent += sent > 0 ? size_t(sent) : 0;
+                }
+                if (fds[l].revents & (POLLIN | POLLHUP | POLLERR)) {
+                    const ssize_t received = recv(link.fd, link.in + link.received, bytes - link.received, 0);
+                    if (received == 0 || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+                        throw std::runtime_error("Un proceso de DistributedWaveSolver2D ha terminado");
+                    }
+                    link.received += received > 0 ? size_t(received) : 0;
+                }
+            }
+        }
+    }
+
+
+    //  -- PROCESOS --
+
+    //  Ruta y argumentos de este programa, para ejecutarlo de nuevo como rango
+    void program(std::string &path, std::vector<std::string> &arguments) {
+#if defined(__linux__)
+        path = "/proc/self/exe";
+        std::ifstream file("/proc/self/cmdline", std::ios::binary);
+        const std::string line((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        for (size_t begin = 0; begin < line.size(); ) {
+            const size_t end = std::min(line.find('\0', begin), line.size());
+            arguments.push_back(line.substr(begin, end - begin));
+            begin = end + 1;
+        }
+#elif defined(__APPLE__)
+        uint32_t size = 0;
+        _NSGetExecutablePath(nullptr, &size);
+        std::vector<char> buffer(size + 1, '\0');
+        _NSGetExecutablePath(buffer.data(), &size);
+        path = buffer.data();
+        for (int k = 0; k < *_NSGetArgc(); ++k) {
+            arguments.push_back((*_NSGetArgv())[k]);
+        }
+#else
+        throw std::logic_error("DistributedWaveSolver2D sólo está disponible en Linux y macOS");
+#endif
+        if (arguments.empty()) {
+            arguments.push_back(path);
+        }
+    }
+
+    //  Entorno de los rangos: el del programa con CDA_WAVE_RANK, \p threads hilos por rango y sin fijarlos a CPUs
+    std::vector<std::string> environment(const size_t &threads) {
+#if defined(__APPLE__)
+        char **variables = *_NSGetEnviron();
+#else
+        char **variables = environ;
+#endif
+        std::vector<std::string> result;
+        for (char **it = variables; it && *it; ++it) {
+            const std::string variable = *it;
+            if (variable.compare(0, 14, "CDA_WAVE_RANK=") != 0 && variable.compare(0, 16, "CDA_NUM_THREADS=") != 0 &&
+                variable.compare(0, 13, "CDA_AFFINITY=") != 0) {
+                result.push_back(variable);
+            }
+        }
+        result.push_back("CDA_WAVE_RANK=1");
+        result.push_back("CDA_NUM_THREADS=" + std::to_string(threads));
+        return result;
+    }
+
+    std::vector<char *> pointers(std::vector<std::string> &strings) {
+        std::vector<char *> result;
+        for (std::string &string : strings) {
+            result.push_back(&string[0]);
+        }
+        result.push_back(nullptr);
+        return result;
+    }
+
+
+    //  -- RANGOS --
+
+    //  Solver de las filas de un rango y sus halos. Usa el dy y el dt de la malla completa
+    //  para obtener exactamente los mismos resultados que un solo proceso
+    template <typename Precision>
+    class Rank : public BasicWaveSolver2D<Precision> {
+    public:
+        Rank(const Setup &setup, const Vector<EDP_T> &x, const Vector<EDP_T> &y,
+             const Matrix<EDP_T> &cI, const Matrix<EDP_T> &cId, const Matrix<bool> &fixed,
+             const Matrix<EDP_T> &q, const wave::SampledBoundaries &boundaries) :
+        BasicWaveSolver2D<Precision>(setup.time, setup.dt, setup.bc, x, y, cI, cId, fixed, q, boundaries)
+        {
+            this->dy = setup.dy;
+        }
+    };
+
+    void getCoefficients(Matrix<EDP_T> &q, Vector<EDP_T> &left, Vector<EDP_T> &right, Vector<EDP_T> &top, Vector<EDP_T> &bottom) {
+        get(COORDINATOR, q.begin(), q.rows() * q.columns() * sizeof(EDP_T));
+        get(COORDINATOR, left);
+        get(COORDINATOR, right);
+        get(COORDINATOR, top);
+        get(COORDINATOR, bottom);
+    }
+
+    //  Bucle de un rango: construye su parte de la malla y atiende órdenes hasta que el coordinador cierra el socket
+    template <typename Precision>
+    void serve(const Setup &setup) {
+        typedef typename Precision::value_type value_type;
+        const size_t rows = setup.rows, m = setup.columns;
+        const char ack = 0;
+
+        Vector<EDP_T> x(m), y(rows), left, right, top, bottom;
+        Matrix<EDP_T> cI(rows, m), cId(rows, m), q(rows, m);
+        Matrix<bool> fixed(rows, m);
+        get(COORDINATOR, x.begin(), m * sizeof(EDP_T));
+        get(COORDINATOR, y.begin(), rows * sizeof(EDP_T));
+        get(COORDINATOR, cI.begin(), rows * m * sizeof(EDP_T));
+        get(COORDINATOR, cId.begin(), rows * m * sizeof(EDP_T));
+        get(COORDINATOR, fixed.begin(), rows * m * sizeof(bool));
+
+        Message message;
+        get(COORDINATOR, &message, sizeof(message));
+        if (message.order != COEFFICIENTS) {
+            throw std::logic_error("DistributedWaveSolver2D: orden inesperada");
+        }
+        getCoefficients(q, left, right, top, bottom);
+
+        Rank<Precision> solver(setup, x, y, cI, cId, fixed, q, {left, right, top, bottom});
+        cI.clear();
+        cId.clear();
+        q.clear();
+        put(COORDINATOR, &ack, 1);
+
+        //  Los halos se intercambian sin bloquear (exchange)
+        for (const int fd : {int(ABOVE), int(BELOW)}) {
+            if ((fd == ABOVE && setup.above) || (fd == BELOW && setup.below)) {
+                fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+            }
+        }
+
+        while (receive(COORDINATOR, &message, sizeof(message))) {
+            switch (message.order) {
+                case STEP:
+                    for (size_t s = 0; s < message.count; ++s) {
+                        solver.step();
+
+                        //  Primera y última fila propias a los vecinos; las suyas a los halos
+                        Matrix<value_type> &state = solver.current();
+                        Link links[2];
+                        size_t count = 0;
+                        if (setup.above) {
+                            links[count++] = {ABOVE, reinterpret_cast<const char *>(state[setup.top]), reinterpret_cast<char *>(state[0]), 0, 0};
+                        }
+                        if (setup.below) {
+                            links[count++] = {BELOW, reinterpret_cast<const char *>(state[setup.bottom]), reinterpret_cast<char *>(state[rows - 1]), 0, 0};
+                        }
+                        exchange(links, count, m * sizeof(value_type));
+                    }
+                    break;
+
+                case LOAD:
+                    for (size_t k = 0; k < message.count; ++k) {
+                        uint64_t row;
+                        get(COORDINATOR, &row, sizeof(row));
+                        if (row >= rows) {
+                            throw std::logic_error("DistributedWaveSolver2D: fila fuera de la banda");
+                        }
+                        getRow(COORDINATOR, solver.current()[row], m);
+                    }
+                    break;
+
+                case STORE:
+                    //  Las filas son la respuesta
+                    putRows(COORDINATOR, solver.current(), setup.top, setup.bottom + 1);
+                    continue;
+
+                case FIXED:
+                    get(COORDINATOR, fixed.begin(), rows * m * sizeof(bool));
+                    solver.setFixed(fixed);
+                    break;
+
+                case COEFFICIENTS:
+                    q.resize(rows, m);
+                    getCoefficients(q, left, right, top, bottom);
+                    solver.setCoefficients(q, {left, right, top, bottom});
+                    q.clear();
+                    break;
+
+                default:
+                    throw std::logic_error("DistributedWaveSolver2D: orden inesperada");
+            }
+
+            put(COORDINATOR, &ack, 1);
+        }
+    }
+
+}
+
+
+//  Un rango es este mismo programa ejecutado de nuevo con CDA_WAVE_RANK. Atiende al coordinador y termina
+//  sin volver; los errores se escriben en la salida de errores y el coordinador ve el socket cerrado
+void EDP::runRankIfRequested()
+{
+    if (!std::getenv("CDA_WAVE_RANK")) {
+        return;
+    }
+
+    int status = 1;
+    try {
+        //  El hilo que lo creó podía estar fijado a una CPU (CDA_AFFINITY)
+        parallel::Team::unpin();
+
+        Setup setup;
+        get(COORDINATOR, &setup, sizeof(setup));
+        if (setup.value_size == sizeof(double) && setup.compute_size == sizeof(double)) {
+            serve<DoublePrecision>(setup);
+        } else if (setup.value_size == sizeof(float) && setup.compute_size == sizeof(float)) {
+            serve<SinglePrecision>(setup);
+        } else {
+            throw std::logic_error("DistributedWaveSolver2D: precisión no disponible");
+        }
+        status = 0;
+    } catch (const std::exception &e) {
+        std::cerr << " [Error DistributedWaveSolver2D]: " << e.what() << std::endl;
+    }
+    _exit(status);
+}
+
+
+template <typename Precision>
+BasicDistributedWaveSolver2D<Precision>::BasicDistributedWaveSolver2D(const EDP &equation, unsigned char bc,
+                                                                      const Vector<EDP_T> &x, const Vector<EDP_T> &y,
+                                                                      const Matrix<EDP_T> &cI, const Matrix<EDP_T> &cId,
+                                                                      const Matrix<bool> &fixed) :
+n(y.size()), m(x.size()), _time(equation.time), _dt(equation.dt), _steps(0), bc(bc), x(x), y(y),
+Q2D(equation.Q2D), BCL(equation.BCL), BCR(equation.BCR), BCT(equation.BCT), BCB(equation.BCB),
+broken(false)
+{
+    const size_t processes = equation.processes;
+
+    if (n < 3 || m < 3) {
+        throw std::logic_error("WaveSolver2D necesita al menos 3 puntos en cada dirección");
+    }
+
+    if (cI.rows() != n || cI.columns() != m || cId.rows() != n || cId.columns() != m ||
+        fixed.rows() != n || fixed.columns() != m) {
+        throw std::logic_error("Las dimensiones de cI, cId y fixed deben coincidir con las de y, x");
+    }
+
+    if (processes == 0 || n < 2 * processes) {
+        throw std::logic_error("DistributedWaveSolver2D necesita al menos un proceso y 2 filas por proceso");
+    }
+
+    //  Mismo paso de tiempo que BasicWaveSolver2D con la malla completa
+    const EDP_T dy = WaveGrid2D<Precision>::spacing(y);
+    _dt = WaveGrid2D<Precision>::stableTimeStep(_dt, Q2D(x[0], y[0]), WaveGrid2D<Precision>::spacing(x), dy);
+
+    for (size_t r = 0; r <= processes; ++r) {
+        bounds.push_back(n * r / processes);
+    }
+    _fixed.assign(fixed);
+    sent = cI;
+    synced = true;
+    sample(q, left, right, top, bottom);
+
+    //  Los hilos del equipo se reparten entre los rangos
+    const size_t threads = std::max<size_t>(1, parallel::Team::shared().size() / processes);
+
+    std::string path;
+    std::vector<std::string> arguments, variables = environment(threads);
+    program(path, arguments);
+    const std::vector<char *> argv = pointers(arguments), envp = pointers(variables);
+
+    //  Enlace k: rango k (BELOW) con rango k+1 (ABOVE)
+    std::vector<int> links;
+    try {
+        for (size_t k = 0; k + 1 < processes; ++k) {
+            int pair[2];
+            connect(pair);
+            links.push_back(pair[0]);
+            links.push_back(pair[1]);
+        }
+
+        for (size_t r = 0; r < processes; ++r) {
+            int pair[2];
+            connect(pair);
+            sockets.push_back(pair[0]);
+
+            posix_spawn_file_actions_t actions;
+            posix_spawn_file_actions_init(&actions);
+            posix_spawn_file_actions_adddup2(&actions, pair[1], COORDINATOR);
+            if (r > 0) {
+                posix_spawn_file_actions_adddup2(&actions, links[2 * (r - 1) + 1], ABOVE);
+            }
+            if (r + 1 < processes) {
+                posix_spawn_file_actions_adddup2(&actions, links[2 * r], BELOW);
+            }
+
+            pid_t pid;
+            const int error = posix_spawn(&pid, path.c_str(), &actions, nullptr, argv.data(), envp.data());
+            posix_spawn_file_actions_destroy(&actions);
+            close(pair[1]);
+            if (error != 0) {
+                throw std::runtime_error("No se ha podido crear un proceso de DistributedWaveSolver2D");
+            }
+            ranks.push_back(pid);
+        }
+    } catch (...) {
+        for (const int &fd : links) {
+            close(fd);
+        }
+        broken = true;
+        shutdown();
+        throw;
+    }
+
+    for (const int &fd : links) {
+        close(fd);
+    }
+
+    //  Cada rango recibe sólo sus filas y sus halos, y avisa cuando ha construido su parte de la malla
+    try {
+        for (size_t r = 0; r < processes; ++r) {
+            size_t first, last;
+            halos(n, bounds[r], bounds[r + 1], first, last);
+
+            Setup setup = {};
+            setup.value_size = sizeof(typename Precision::value_type);
+            setup.compute_size = sizeof(typename Precision::compute_type);
+            setup.rows = last - first;
+            setup.columns = m;
+            setup.top = bounds[r] - first;
+            setup.bottom = bounds[r + 1] - 1 - first;
+            setup.above = r > 0;
+            setup.below = r + 1 < processes;
+            setup.bc = bc & ~(setup.above ? BCT_df : 0) & ~(setup.below ? BCB_df : 0);
+            setup.time = _time;
+            setup.dt = _dt;
+            setup.dy = dy;
+
+            const int &fd = sockets[r];
+            put(fd, &setup, sizeof(setup));
+            put(fd, x.begin(), m * sizeof(EDP_T));
+            put(fd, y.begin() + first, (last - first) * sizeof(EDP_T));
+            put(fd, cI[first], (last - first) * m * sizeof(EDP_T));
+            put(fd, cId[first], (last - first) * m * sizeof(EDP_T));
+            put(fd, fixed[first], (last - first) * m * sizeof(bool));
+            sendCoefficients(r);
+        }
+
+        for (size_t r = 0; r < processes; ++r) {
+            acknowledge(r);
+        }
+    } catch (...) {
+        broken = true;
+        shutdown();
+        throw;
+    }
+}
+
+template <typename Precision>
+BasicDistributedWaveSolver2D<Precision>::~BasicDistributedWaveSolver2D()
+{
+    shutdown();
+}
+
+template <typename Precision>
+void BasicDistributedWaveSolver2D<Precision>::shutdown()
+{
+    //  Al cerrar los sockets los rangos terminan
+    for (const int &fd : sockets) {
+        close(fd);
+    }
+    sockets.clear();
+
+    for (const pid_t &pid : ranks) {
+        if (broken) {
+            kill(pid, SIGKILL);
+        }
+        waitpid(pid, nullptr, 0);
+    }
+    ranks.clear();
+}
+
+template <typename Precision>
+void BasicDistributedWaveSolver2D<Precision>::step(size_t steps)
+{
+    if (steps == 0) {
+        return;
+    }
+
+    check();
+    try {
+        const Message message = {STEP, steps};
+        for (const int &fd : sockets) {
+            put(fd, &message, sizeof(message));
+        }
+        for (size_t r = 0; r < ranks.size(); ++r) {
+            acknowledge(r);
+        }
+    } catch (...) {
+        broken = true;
+        throw;
+    }
+
+    for (size_t s = 0; s < steps; ++s) {
+        _time += _dt;
+    }
+    _steps += steps;
+    synced = false;
+}
+
+template <typename Precision>
+void BasicDistributedWaveSolver2D<Precision>::load(const Matrix<EDP_T> &state)
+{
+    if (state.rows() != n || state.columns() != m) {
+        throw std::logic_error("Las dimensiones del estado deben coincidir con las de y, x");
+    }
+
+    check();
+
+    //  Filas distintas, bit a bit, de las que tienen los rangos (todas si no se conocen)
+    std::vector<char> changed(n, 1);
+    if (synced) {
+        parallel::parallel_for(0, n, [&](const size_t &from, const size_t &to) {
+            for (size_t i = from; i < to; ++i) {
+                changed[i] = !same(state[i], sent[i], m);
+            }
+        }, std::max<size_t>(1, CDA_PARALLEL_GRAIN / m));
+    }
+
+    //  Sólo las filas que han cambiado, también en los halos de los vecinos
+    try {
+        std::vector<size_t> loaded;
+        for (size_t r = 0; r < ranks.size(); ++r) {
+            size_t first, last;
+            halos(n, bounds[r], bounds[r + 1], first, last);
+
+            std::vector<uint64_t> rows;
+            for (size_t i = first; i < last; ++i) {
+                if (changed[i]) {
+                    rows.push_back(i - first);
+                }
+            }
+            if (rows.empty()) {
+                continue;
+            }
+
+            const Message message = {LOAD, rows.size()};
+            put(sockets[r], &message, sizeof(message));
+            for (const uint64_t &row : rows) {
+                put(sockets[r], &row, sizeof(row));
+                put(sockets[r], state[first + row], m * sizeof(EDP_T));
+            }
+            loaded.push_back(r);
+        }
+
+        for (const size_t &r : loaded) {
+            acknowledge(r);
+        }
+    } catch (...) {
+        broken = true;
+        throw;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        if (changed[i]) {
+            std::copy(state[i], state[i] + m, sent[i]);
+        }
+    }
+    synced = true;
+}
+
+template <typename Precision>
+void BasicDistributedWaveSolver2D<Precision>::store(Matrix<EDP_T> &state) const
+{
+    if (state.rows() != n || state.columns() != m) {
+        throw std::logic_error("Las dimensiones del estado deben coincidir con las de y, x");
+    }
+
+    check();
+    try {
+        const Message message = {STORE, 0};
+        for (const int &fd : sockets) {
+            put(fd, &message, sizeof(message));
+        }
+        for (size_t r = 0; r < ranks.size(); ++r) {
+            get(sockets[r], state[bounds[r]], (bounds[r + 1] - bounds[r]) * m * sizeof(EDP_T));
+        }
+    } catch (...) {
+        broken = true;
+        throw;
+    }
+
+    sent = state;
+    synced = true;
+}
+
+template <typename Precision>
+void BasicDistributedWaveSolver2D<Precision>::setFixed(const Matrix<bool> &fixed)
+{
+    if (fixed.rows() != n || fixed.columns() != m) {
+        throw std::logic_error("Las dimensiones de fixed deben coincidir con las de y, x");
+    }
+
+    //  solveWAVE la pasa en cada llamada: los procesos sólo la reciben si cambia
+    if (_fixed.matches(fixed)) {
+        return;
+    }
+
+    check();
+    try {
+        const Message message = {FIXED, 0};
+        for (size_t r = 0; r < ranks.size(); ++r) {
+            size_t first, last;
+            halos(n, bounds[r], bounds[r + 1], first, last);
+            put(sockets[r], &message, sizeof(message));
+            put(sockets[r], fixed[first], (last - first) * m * sizeof(bool));
+        }
+        for (size_t r = 0; r < ranks.size(); ++r) {
+            acknowledge(r);
+        }
+    } catch (...) {
+        broken = true;
+        throw;
+    }
+
+    _fixed.assign(fixed);
+}
+
+template <typename Precision>
+void BasicDistributedWaveSolver2D<Precision>::setCoefficients(const EDP &equation, bool cache)
+{
+    if (cache && Q2D == equation.Q2D && BCL == equation.BCL && BCR == equation.BCR && BCT == equation.BCT && BCB == equation.BCB) {
+        return;
+    }
+
+    Q2D = equation.Q2D;
+    BCL = equation.BCL;
+    BCR = equation.BCR;
+    BCT = equation.BCT;
+    BCB = equation.BCB;
+
+    check();
+
+    //  Sin CACHE_COEFFICIENTS se muestrean en cada llamada, pero cada rango sólo recibe su banda si ha cambiado
+    Matrix<EDP_T> sampled;
+    Vector<EDP_T> sampledLeft, sampledRight, sampledTop, sampledBottom;
+    sample(sampled, sampledLeft, sampledRight, sampledTop, sampledBottom);
+
+    std::vector<size_t> changed;
+    for (size_t r = 0; r < ranks.size(); ++r) {
+        size_t first, last;
+        halos(n, bounds[r], bounds[r + 1], first, last);
+
+        bool equal = same(sampled[first], q[first], (last - first) * m);
+        if (left.size() > 0) {
+            equal = equal && same(sampledLeft.begin() + first, left.begin() + first, last - first);
+        }
+        if (right.size() > 0) {
+            equal = equal && same(sampledRight.begin() + first, right.begin() + first, last - first);
+        }
+        if (first == 0) {
+            equal = equal && same(sampledTop.begin(), top.begin(), top.size());
+        }
+        if (last == n) {
+            equal = equal && same(sampledBottom.begin(), bottom.begin(), bottom.size());
+        }
+        if (!equal) {
+            changed.push_back(r);
+        }
+    }
+
+    q = std::move(sampled);
+    left = std::move(sampledLeft);
+    right = std::move(sampledRight);
+    top = std::move(sampledTop);
+    bottom = std::move(sampledBottom);
+
+    try {
+        for (const size_t &r : changed) {
+            sendCoefficients(r);
+        }
+        for (const size_t &r : changed) {
+            acknowledge(r);
+        }
+    } catch (...) {
+        broken = true;
+        throw;
+    }
+}
+
+template <typename Precision>
+void BasicDistributedWaveSolver2D<Precision>::sample(Matrix<EDP_T> &q, Vector<EDP_T> &left, Vector<EDP_T> &right,
+                                                     Vector<EDP_T> &top, Vector<EDP_T> &bottom) const
+{
+    q.resize(n, m);
+    parallel::parallel_for(0, n, [&](const size_t &from, const size_t &to) {
+        for (size_t i = from; i < to; ++i) {
+            for (size_t j = 0; j < m; ++j) {
+                q[i][j] = Q2D(x[j], y[i]);
+            }
+        }
+    }, std::max<size_t>(1, CDA_PARALLEL_GRAIN / m));
+
+    //  Sólo los bordes con condición en la derivada
+    left.resize((bc & BCL_df) ? n : 0);
+    for (size_t i = 0; i < left.size(); ++i) {
+        left[i] = BCL(x[0], y[i]);
+    }
+    right.resize((bc & BCR_df) ? n : 0);
+    for (size_t i = 0; i < right.size(); ++i) {
+        right[i] = BCR(x[m-1], y[i]);
+    }
+    top.resize((bc & BCT_df) ? m : 0);
+    for (size_t j = 0; j < top.size(); ++j) {
+        top[j] = BCT(x[j], y[0]);
+    }
+    bottom.resize((bc & BCB_df) ? m : 0);
+    for (size_t j = 0; j < bottom.size(); ++j) {
+        bottom[j] = BCB(x[j], y[n-1]);
+    }
+}
+
+template <typename Precision>
+void BasicDistributedWaveSolver2D<Precision>::sendCoefficients(const size_t &r)
+{
+    size_t first, last;
+    halos(n, bounds[r], bounds[r + 1], first, last);
+    const size_t rows = last - first;
+
+    //  Los bordes superior e inferior sólo son de la malla completa en el primer y el último rango
+    Vector<EDP_T> bandLeft, bandRight;
+    if (left.size() > 0) {
+        bandLeft.resize(rows);
+        std::copy(left.begin() + first, left.begin() + last, bandLeft.begin());
+    }
+    if (right.size() > 0) {
+        bandRight.resize(rows);
+        std::copy(right.begin() + first, right.begin() + last, bandRight.begin());
+    }
+
+    const int &fd = sockets[r];
+    const Message message = {COEFFICIENTS, 0};
+    put(fd, &message, sizeof(message));
+    put(fd, q[first], rows * m * sizeof(EDP_T));
+    put(fd, bandLeft);
+    put(fd, bandRight);
+    put(fd, first == 0 ? top : Vector<EDP_T>());
+    put(fd, last == n ? bottom : Vector<EDP_T>());
+}
+
+template <typename Precision>
+void BasicDistributedWaveSolver2D<Precision>::acknowledge(const size_t &r) const
+{
+    char ack;
+    get(sockets[r], &ack, 1);
+}
+
+template <typename Precision>
+void BasicDistributedWaveSolver2D<Precision>::check() const
+{
+    if (broken) {
+        throw std::runtime_error("Un proceso de DistributedWaveSolver2D ha terminado");
+    }
+}
+
+
+template class cda::math::differential_equations::BasicDistributedWaveSolver2D<DoublePrecision>;
+template class cda::math::differential_equations::BasicDistributedWaveSolver2D<SinglePrecision>;
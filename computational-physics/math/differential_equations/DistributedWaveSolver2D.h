@@ -0,0 +1,156 @@
+//
+//  DistributedWaveSolver2D.h
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <sys/types.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "SolveEDP.h"
+#include "Precision.h"
+#include "FixedMask.h"
+
+
+namespace cda {
+    namespace math {
+        namespace differential_equations {
+
+            //  -- ECUACIÓN DE ONDAS EN 2 DIMENSIONES REPARTIDA ENTRE PROCESOS --
+            //  Mismo esquema y mismos resultados que BasicWaveSolver2D, pero la malla se reparte por filas entre
+            //  varios procesos locales (rangos). Cada rango sólo recibe y guarda sus filas más una fila de halo
+            //  a cada lado, así que la memoria de las mallas se reparte entre los procesos.
+            //
+            //  Los rangos son este mismo programa ejecutado de nuevo con posix_spawn() (no fork(), que no es
+            //  seguro con hilos en marcha) y la variable de entorno CDA_WAVE_RANK. Son procesos nuevos: crean
+            //  los hilos de su equipo al dar el primer paso. Todo programa que use varios procesos debe llamar a
+            //  EDP::runRankIfRequested() al principio de main(), que en un rango atiende al coordinador y
+            //  termina sin volver.
+            //
+            //  Cada rango está conectado por sockets Unix con el coordinador y con sus vecinos. Después de cada
+            //  paso envía su primera y su última fila a los vecinos y recibe las suyas en los halos (intercambio
+            //  de una celda), así que step() no pasa ninguna fila por el coordinador.
+            //
+            //  El coordinador no guarda la malla: Q2D y las condiciones de contorno se muestrean en él, porque
+            //  sus funciones no existen en los rangos, y se envían por bandas. load() y store() reparten y
+            //  recogen el estado completo fila a fila. El coordinador guarda una copia de lo último que ha
+            //  enviado o recibido, así que load() sólo envía las filas que difieren de ella bit a bit, como las
+            //  que modifica una fuerza externa, y setCoefficients() sólo las bandas cuyos coeficientes cambian.
+            template <typename Precision>
+            class BasicDistributedWaveSolver2D {
+            public:
+                typedef typename Precision::value_type value_type;
+
+                /**
+                 @param equation Ecuación de la que se toman Q2D, BCL, BCR, BCT, BCB, dt, time y processes
+                 @param bc Condiciones de contorno (BCx_df). Los bordes sin condición en la derivada no cambian
+                 @param x Coordenadas de las columnas
+                 @param y Coordenadas de las filas
+                 @param cI Condición inicial
+                 @param cId Derivada temporal inicial
+                 @param fixed Puntos que no evolucionan
+                 */
+                BasicDistributedWaveSolver2D(const EDP &equation, unsigned char bc,
+                                             const containers::Vector<EDP_T> &x, const containers::Vector<EDP_T> &y,
+                                             const containers::Matrix<EDP_T> &cI, const containers::Matrix<EDP_T> &cId,
+                                             const containers::Matrix<bool> &fixed);
+
+                //  Termina los rangos
+                ~BasicDistributedWaveSolver2D();
+
+                BasicDistributedWaveSolver2D(const BasicDistributedWaveSolver2D &) = delete;
+                BasicDistributedWaveSolver2D &operator=(const BasicDistributedWaveSolver2D &) = delete;
+
+                /**
+                 Avanza \p steps pasos de tiempo, con un intercambio de halos después de cada uno
+                 */
+                void step(size_t steps = 1);
+
+                /**
+                 Sustituye el estado actual (p. ej. para aplicar una fuerza externa). El anterior no cambia.
+                 Después de store() sólo se envían a los rangos las filas de \p state que han cambiado
+                 */
+                void load(const containers::Matrix<EDP_T> &state);
+
+                /**
+                 Copia el estado actual en \p state, que debe tener las dimensiones de la malla
+                 */
+                void store(containers::Matrix<EDP_T> &state) const;
+
+                /**
+                 Cambia los puntos fijos. Puede llamarse entre pasos
+                 */
+                void setFixed(const containers::Matrix<bool> &fixed);
+
+                /**
+                 Toma Q2D, BCL, BCR, BCT y BCB de \p equation, las vuelve a muestrear y envía a cada rango
+                 su banda si ha cambiado
+
+                 @param cache Si es true (opción CACHE_COEFFICIENTS) sólo se muestrean si alguna función ha cambiado
+                 */
+                void setCoefficients(const EDP &equation, bool cache = false);
+
+                EDP_T time() const { return _time; }
+                EDP_T dt() const { return _dt; }
+                size_t steps() const { return _steps; }
+                size_t rows() const { return n; }
+                size_t columns() const { return m; }
+                size_t processes() const { return ranks.size(); }
+
+            private:
+
+                //  Muestrea Q2D y las condiciones de contorno con derivada en toda la malla
+                void sample(containers::Matrix<EDP_T> &q, containers::Vector<EDP_T> &left, containers::Vector<EDP_T> &right,
+                            containers::Vector<EDP_T> &top, containers::Vector<EDP_T> &bottom) const;
+
+                //  Envía al rango \p r su banda de q y de los bordes. Hay que esperar su confirmación
+                void sendCoefficients(const size_t &r);
+
+                //  Espera la confirmación del rango \p r de la última orden
+                void acknowledge(const size_t &r) const;
+
+                //  Cierra los sockets y espera a que terminen los rangos (los mata si alguno ha fallado)
+                void shutdown();
+
+                //  Lanza std::runtime_error si un rango ha terminado
+                void check() const;
+
+                size_t n, m;
+                EDP_T _time, _dt;
+                size_t _steps;
+                unsigned char bc;
+
+                containers::Vector<EDP_T> x, y;
+                EDP_T (* Q2D)(EDP_T x, EDP_T y);
+                EDP_T (* BCL)(EDP_T x, EDP_T y), (* BCR)(EDP_T x, EDP_T y), (* BCT)(EDP_T x, EDP_T y), (* BCB)(EDP_T x, EDP_T y);
+
+                //  Rangos, socket con cada uno y sus filas [lo, hi)
+                std::vector<pid_t> ranks;
+                std::vector<int> sockets;
+                std::vector<size_t> bounds;
+
+                //  Puntos fijos de los rangos (un bit por punto), para saber en setFixed() si cambian
+                FixedMask _fixed;
+
+                //  Estado de los rangos en el último load() o store(). synced es false si después han dado algún paso
+                mutable containers::Matrix<EDP_T> sent;
+                mutable bool synced;
+
+                //  Coeficientes que tienen los rangos
+                containers::Matrix<EDP_T> q;
+                containers::Vector<EDP_T> left, right, top, bottom;
+
+                mutable bool broken;
+            };
+
+            typedef BasicDistributedWaveSolver2D<DoublePrecision> DistributedWaveSolver2D;
+
+        } /* namespace differential_equations */
+    } /* namespace math */
+} /* namespace cda */
@@ -0,0 +1,97 @@
+//
+//  FixedMask.cpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#include "FixedMask.h"
+
+#include <algorithm>
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+FixedMask::FixedMask() : n(0), m(0)
+{
+}
+
+FixedMask::FixedMask(const Matrix<bool> &fixed) : FixedMask()
+{
+    assign(fixed);
+}
+
+void FixedMask::assign(const Matrix<bool> &fixed)
+{
+    n = fixed.rows();
+    m = fixed.columns();
+
+    bits.resize((n*m + 63) / 64, false);
+    offsets.resize(n + 1, false);
+    std::fill(bits.begin(), bits.end(), 0);
+
+    //  Primera pasada: bits y número de puntos fijos de cada fila
+    offsets[0] = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const bool *f = fixed[i];
+        size_t count = 0;
+        for (size_t j = 0; j < m; ++j) {
+            count += f[j];
+        }
+
+        if (count) {
+            for (size_t j = 0; j < m; ++j) {
+                if (f[j]) {
+                    const size_t k = i*m + j;
+                    bits[k / 64] |= uint64_t(1) << (k % 64);
+                }
+            }
+        }
+
+        offsets[i + 1] = offsets[i] + count;
+    }
+
+    //  Segunda pasada: columnas de los puntos fijos
+    indices.resize(offsets[n], false);
+    for (size_t i = 0; i < n; ++i) {
+        if (offsets[i + 1] == offsets[i]) {
+            continue;
+        }
+
+        const bool *f = fixed[i];
+        size_t *index = indices.begin() + offsets[i];
+        for (size_t j = 0; j < m; ++j) {
+            if (f[j]) {
+                *index++ = j;
+            }
+        }
+    }
+}
+
+bool FixedMask::matches(const Matrix<bool> &fixed) const
+{
+    if (fixed.rows() != n || fixed.columns() != m) {
+        return false;
+    }
+
+    //  Cada fila debe tener fijas exactamente las columnas de su lista
+    for (size_t i = 0; i < n; ++i) {
+        const bool *f = fixed[i];
+        const size_t *index = begin(i), *last = end(i);
+        for (size_t j = 0; j < m; ++j) {
+            if (f[j]) {
+                if (index == last || *index != j) {
+                    return false;
+                }
+                ++index;
+            }
+        }
+        if (index != last) {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,68 @@
+//
+//  FixedMask.h
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "../containers.hpp"
+
+
+namespace cda {
+    namespace math {
+        namespace differential_equations {
+
+            //  -- MÁSCARA DE PUNTOS FIJOS --
+            //  Guarda los puntos fijos de una malla de dos formas:
+            //      - Un bit por punto, para consultas sueltas (bordes)
+            //      - La lista de columnas fijas de cada fila, para que los esquemas recorran el interior sin
+            //        consultar la máscara y después restauren sólo los puntos fijos
+            //
+            //  En los escenarios de main.cpp los puntos fijos forman paredes finas, así que la lista es corta.
+            class FixedMask {
+            public:
+
+                FixedMask();
+                explicit FixedMask(const containers::Matrix<bool> &fixed);
+
+                /**
+                 Toma los puntos fijos de \p fixed. Sólo reserva memoria si cambian las dimensiones o el número de puntos fijos
+                 */
+                void assign(const containers::Matrix<bool> &fixed);
+
+                /**
+                 Indica si \p fixed tiene los mismos puntos fijos, sin reservar memoria. Para no reconstruir la
+                 máscara ni volver a repartir las filas cuando no cambia entre llamadas
+                 */
+                bool matches(const containers::Matrix<bool> &fixed) const;
+
+                bool operator()(const size_t &row, const size_t &column) const {
+                    const size_t k = row * m + column;
+                    return (bits[k / 64] >> (k % 64)) & 1;
+                }
+
+                //  Columnas fijas de la fila row, en orden creciente
+                const size_t *begin(const size_t &row) const { return indices.begin() + offsets[row]; }
+                const size_t *end(const size_t &row) const { return indices.begin() + offsets[row + 1]; }
+
+                //  Número de puntos fijos
+                size_t count() const { return indices.size(); }
+
+                size_t rows() const { return n; }
+                size_t columns() const { return m; }
+
+            private:
+                size_t n, m;
+                containers::Vector<uint64_t> bits;
+                containers::Vector<size_t> offsets;     //  Fila i: indices[offsets[i]] ... indices[offsets[i+1]-1]
+                containers::Vector<size_t> indices;
+            };
+
+        } /* namespace differential_equations */
+    } /* namespace math */
+} /* namespace cda */
@@ -0,0 +1,935 @@
+//
+//  PoissonSolver2D.cpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#include "PoissonSolver2D.h"
+
+#include "../algorithms/transforms/fft.hpp"
+#include "../parallel/team.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+namespace {
+
+    //  Puntos del color de la fila i que empiezan en j (1 o 2), saltando de 2 en 2.
+    //  Sólo leen puntos del otro color, así que no hay dependencias entre ellos dentro de la fila
+    template <bool Poisson>
+    EDP_T relax_row(const EDP_T *up, EDP_T *row, const EDP_T *down, const EDP_T *rhs, size_t j, const size_t &m,
+                    const EDP_T &ax, const EDP_T &ay, const EDP_T &omega) {
+        const EDP_T d = 2.0*(ax + ay);
+        EDP_T change = 0;
+
+        for (; j < m-1; j += 2) {
+            const EDP_T gs = (ax*(up[j] + down[j]) + ay*(row[j+1] + row[j-1]) - (Poisson ? rhs[j] : 0))/d;
+            const EDP_T delta = omega*(gs - row[j]);
+            row[j] += delta;
+            change += std::abs(delta);
+        }
+
+        return change;
+    }
+
+    //  Índice k reflejado en los bordes de [0, n): el punto fantasma de un borde libre es el simétrico
+    inline size_t reflect(const long &k, const size_t &n) {
+        return k < 0 ? size_t(-k) : (k > long(n) - 1 ? size_t(2*(long(n) - 1) - k) : size_t(k));
+    }
+
+    //  Filas por hilo para que cada uno reciba al menos CDA_TEAM_GRAIN puntos
+    inline size_t row_grain(const size_t &m) {
+        return std::max<size_t>(1, CDA_TEAM_GRAIN / std::max<size_t>(m, 1));
+    }
+
+    //  Transferencia lineal en una dirección entre una malla de fine puntos y otra de coarse puntos con los
+    //  mismos extremos. Con un número par de intervalos los puntos gruesos son los pares de la fina (1 2 1)/4;
+    //  con uno impar las mallas no están anidadas y los pesos salen de la interpolación lineal
+    struct Transfer {
+        //  Restricción: índices finos (reflejados en los bordes) y pesos de cada punto grueso
+        std::vector<std::vector<std::pair<size_t, EDP_T>>> restriction;
+        //  Prolongación: punto grueso anterior, el siguiente y el peso de éste en cada punto fino
+        std::vector<size_t> below, above;
+        std::vector<EDP_T> weight;
+
+        Transfer() = default;
+
+        Transfer(const size_t &fine, const size_t &coarse) :
+        restriction(coarse), below(fine), above(fine), weight(fine) {
+            //  En unidades de la malla gruesa el punto fino i está en i·N/F, con F y N los intervalos de cada malla
+            const long F = long(fine) - 1, N = long(coarse) - 1;
+
+            for (long i = 0; i <= F; ++i) {
+                below[i] = size_t(i*N/F);
+                above[i] = std::min(below[i] + 1, size_t(N));
+                weight[i] = EDP_T(i*N % F)/F;
+            }
+
+            //  Traspuesta de la interpolación por N/F sobre la malla reflejada: los pesos de cada punto grueso suman 1
+            for (long I = 0; I <= N; ++I) {
+                for (long i = (I*F - F)/N; i <= (I*F + F)/N + 1; ++i) {
+                    const long distance = std::abs(i*N - I*F);
+                    if (distance < F) {
+                        restriction[I].emplace_back(reflect(i, fine), (EDP_T(N)/F)*(EDP_T(F - distance)/F));
+                    }
+                }
+            }
+        }
+    };
+
+    //  Restricción de ponderación completa de fine a coarse, dirección a dirección
+    void restrict_full(const Matrix<EDP_T> &fine, Matrix<EDP_T> &coarse, const Transfer &rows, const Transfer &columns) {
+        cda::math::parallel::Team::shared().for_each(0, coarse.rows(), [&](const size_t &from, const size_t &to) {
+            for (size_t I = from; I < to; ++I) {
+                for (size_t J = 0; J < coarse.columns(); ++J) {
+                    EDP_T sum = 0;
+                    for (const std::pair<size_t, EDP_T> &row : rows.restriction[I]) {
+                        const EDP_T *values = fine[row.first];
+                        for (const std::pair<size_t, EDP_T> &column : columns.restriction[J]) {
+                            sum += row.second*column.second*values[column.first];
+                        }
+                    }
+                    coarse[I][J] = sum;
+                }
+            }
+        }, row_grain(fine.columns()));
+    }
+
+    //  Suma a fine la interpolación bilineal de coarse
+    void prolong_add(const Matrix<EDP_T> &coarse, Matrix<EDP_T> &fine, const Transfer &rows, const Transfer &columns) {
+        const size_t m = fine.columns();
+
+        cda::math::parallel::Team::shared().for_each(0, fine.rows(), [&](const size_t &from, const size_t &to) {
+            for (size_t i = from; i < to; ++i) {
+                const EDP_T *c0 = coarse[rows.below[i]], *c1 = coarse[rows.above[i]], wi = rows.weight[i];
+                EDP_T *row = fine[i];
+                for (size_t j = 0; j < m; ++j) {
+                    const size_t J0 = columns.below[j], J1 = columns.above[j];
+                    const EDP_T wj = columns.weight[j];
+                    row[j] += (1.0 - wi)*((1.0 - wj)*c0[J0] + wj*c0[J1]) + wi*((1.0 - wj)*c1[J0] + wj*c1[J1]);
+                }
+            }
+        }, row_grain(m));
+    }
+
+    //  Suma y máximo de una pasada sobre la malla
+    struct Reduction {
+        EDP_T sum, max;
+    };
+
+    //  Reparte function(from, to) por filas de [begin, end) entre el equipo y combina los resultados parciales
+    //  en el orden de los miembros, así que el resultado no depende de qué hilo termina antes
+    template <typename Function>
+    Reduction reduce_rows(const size_t &begin, const size_t &end, const size_t &m, const Function &function) {
+        cda::math::parallel::Team &team = cda::math::parallel::Team::shared();
+        const size_t count = std::min(std::max<size_t>(1, (end - begin)*m / CDA_TEAM_GRAIN), team.size());
+        std::vector<Reduction> partial(count, Reduction{0, 0});
+
+        team.run([&](const cda::math::parallel::Team::Member &member) {
+            size_t from, to;
+            member.range(begin, end, from, to);
+            if (from < to) {
+                partial[member.index()] = function(from, to);
+            }
+        }, count);
+
+        Reduction total = {0, 0};
+        for (const Reduction &reduction : partial) {
+            total.sum += reduction.sum;
+            total.max = std::max(total.max, reduction.max);
+        }
+        return total;
+    }
+
+    typedef cda::math::algorithms::transforms::TrigonometricTransform<EDP_T> Transform;
+
+    //  Transforma cada fila de a, de dos en dos
+    void transform_rows(Matrix<EDP_T> &a, const Transform &transform) {
+        const size_t pairs = (a.rows() + 1)/2;
+
+        cda::math::parallel::Team::shared().for_each(0, pairs, [&](const size_t &from, const size_t &to) {
+            std::vector<Transform::complex_type> work, buffer;
+            for (size_t p = from; p < to; ++p) {
+                transform(a[2*p], 2*p + 1 < a.rows() ? a[2*p + 1] : nullptr, work, buffer);
+            }
+        }, row_grain(4*a.columns()));
+    }
+
+    //  t = aᵀ por bloques, para no recorrer a por columnas
+    void transpose(const Matrix<EDP_T> &a, Matrix<EDP_T> &t) {
+        const size_t block = 32;
+
+        cda::math::parallel::Team::shared().for_each(0, (t.rows() + block - 1)/block, [&](const size_t &from, const size_t &to) {
+            for (size_t jb = from*block; jb < std::min(to*block, t.rows()); jb += block) {
+                for (size_t ib = 0; ib < a.rows(); ib += block) {
+                    for (size_t i = ib; i < std::min(ib + block, a.rows()); ++i) {
+                        for (size_t j = jb; j < std::min(jb + block, t.rows()); ++j) {
+                            t[j][i] = a[i][j];
+                        }
+                    }
+                }
+            }
+        }, std::max<size_t>(1, CDA_TEAM_GRAIN/(block*std::max<size_t>(a.rows(), 1))));
+    }
+
+}
+
+
+struct PoissonSolver2D::Level {
+    size_t n, m;
+    EDP_T hx, hy;
+    bool left, right, top, bottom;      //  Bordes libres (condición en la derivada, homogénea)
+    Matrix<EDP_T> e, r, res;            //  Error, residuo que se quiere anular y residuo de e
+    Transfer rows, columns;             //  Desde la malla anterior, más fina
+
+    Level(const size_t &n, const size_t &m, const EDP_T &hx, const EDP_T &hy,
+          const bool &left, const bool &right, const bool &top, const bool &bottom) :
+    n(n), m(m), hx(hx), hy(hy), left(left), right(right), top(top), bottom(bottom),
+    e(n, m, 0), r(n, m, 0), res(n, m, 0) {
+
+    }
+
+    //  Puntos libres: filas [i0, i1) y columnas [j0, j1)
+    size_t i0() const { return top ? 0 : 1; }
+    size_t i1() const { return bottom ? n : n-1; }
+    size_t j0() const { return left ? 0 : 1; }
+    size_t j1() const { return right ? m : m-1; }
+
+    //  Queda algo que resolver con la mitad de intervalos
+    bool coarsens() const {
+        return n > 3 && m > 3;
+    }
+
+    //  Mitad de intervalos, redondeando hacia arriba si son impares
+    Level coarse() const {
+        const size_t N = n/2 + 1, M = m/2 + 1;
+        Level level(N, M, hx*(EDP_T(m - 1)/EDP_T(M - 1)), hy*(EDP_T(n - 1)/EDP_T(N - 1)), left, right, top, bottom);
+        level.rows = Transfer(n, N);
+        level.columns = Transfer(m, M);
+        return level;
+    }
+
+    //  Barridos rojo-negro de ∆e = r con relajación omega
+    void smooth(const size_t &sweeps, const EDP_T &omega) {
+        const EDP_T ax = hx*hx, ay = hy*hy, d = 2.0*(ax + ay);
+
+        for (size_t sweep = 0; sweep < 2*sweeps; ++sweep) {
+            const size_t color = sweep % 2;
+            parallel::Team::shared().for_each(i0(), i1(), [&](const size_t &from, const size_t &to) {
+                for (size_t i = from; i < to; ++i) {
+                    const EDP_T *up = e[reflect(long(i) - 1, n)], *down = e[reflect(long(i) + 1, n)], *rhs = r[i];
+                    EDP_T *row = e[i];
+                    for (size_t j = j0() + ((i + j0() + color) & 1); j < j1(); j += 2) {
+                        const EDP_T gs = (ax*(up[j] + down[j]) + ay*(row[reflect(long(j) - 1, m)] + row[reflect(long(j) + 1, m)]) - ax*ay*rhs[j])/d;
+                        row[j] += omega*(gs - row[j]);
+                    }
+                }
+            }, row_grain(m));
+        }
+    }
+
+    //  res = r - ∆e en los puntos libres
+    void residual() {
+        const EDP_T ax = hx*hx, ay = hy*hy;
+        res.zero();
+
+        parallel::Team::shared().for_each(i0(), i1(), [&](const size_t &from, const size_t &to) {
+            for (size_t i = from; i < to; ++i) {
+                const EDP_T *up = e[reflect(long(i) - 1, n)], *down = e[reflect(long(i) + 1, n)], *row = e[i];
+                for (size_t j = j0(); j < j1(); ++j) {
+                    const EDP_T lap = (up[j] + down[j] - 2.0*row[j])/ay +
+                                      (row[reflect(long(j) - 1, m)] + row[reflect(long(j) + 1, m)] - 2.0*row[j])/ax;
+                    res[i][j] = r[i][j] - lap;
+                }
+            }
+        }, row_grain(m));
+    }
+};
+
+
+PoissonSolver2D::PoissonSolver2D(const EDP &equation, unsigned char bc, unsigned char sbc,
+                                 const Vector<EDP_T> &x, const Vector<EDP_T> &y, bool poisson) :
+n(y.size()), m(x.size()), bc(bc), sbc(sbc),
+SBCL(equation.SBCL), SBCR(equation.SBCR), SBCT(equation.SBCT), SBCB(equation.SBCB), SBCI(equation.SBCI)
+{
+    if (n < 3 || m < 3) {
+        throw std::logic_error("PoissonSolver2D necesita al menos 3 puntos en cada dirección");
+    }
+
+    hx = (EDP_T)(x[m-1] - x[0])/(m-1);
+    hy = (EDP_T)(y[n-1] - y[0])/(n-1);
+
+    if (poisson) {
+        f.resize(n, m);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < m; ++j) {
+                f[i][j] = hy*hy*hx*hx*equation.F(x[j], y[i]);
+            }
+        }
+    }
+
+    //  La misma función da el valor del borde (BCx_f) o el de la derivada (BCx_df)
+    left.resize(n);
+    right.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        if ((bc & (BCL_f | BCL_df)) != 0) {
+            left[i] = equation.BCL(x[0], y[i]);
+        }
+        if ((bc & (BCR_f | BCR_df)) != 0) {
+            right[i] = equation.BCR(x[m-1], y[i]);
+        }
+    }
+
+    top.resize(m);
+    bottom.resize(m);
+    for (size_t j = 0; j < m; ++j) {
+        if ((bc & (BCT_f | BCT_df)) != 0) {
+            top[j] = equation.BCT(x[j], y[0]);
+        }
+        if ((bc & (BCB_f | BCB_df)) != 0) {
+            bottom[j] = equation.BCB(x[j], y[n-1]);
+        }
+    }
+}
+
+void PoissonSolver2D::dirichlet(Matrix<EDP_T> &sol) const
+{
+    for (size_t j = 0; j < m; ++j) {
+        if ((bc & BCT_f) != 0) {
+            sol[0][j] = top[j];
+        }
+        if ((bc & BCB_f) != 0) {
+            sol[n-1][j] = bottom[j];
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        if ((bc & BCL_f) != 0) {
+            sol[i][0] = left[i];
+        }
+        if ((bc & BCR_f) != 0) {
+            sol[i][m-1] = right[i];
+        }
+    }
+}
+
+void PoissonSolver2D::boundaries(Matrix<EDP_T> &sol) const
+{
+    const EDP_T ax = hx*hx, ay = hy*hy, d = 2.0*(ax + ay);
+    const bool poisson = f.rows() > 0;
+
+    //  Bordes izquierdo y derecho
+    for (size_t i = 1; i < n-1; ++i) {
+        if (bc & BCL_df) {
+            sol[i][0] = (ax*(sol[i+1][0] + sol[i-1][0]) + ay*2*(sol[i][1] + hx*left[i]) - (poisson ? f[i][0] : 0))/d;
+        }
+
+        if (sbc & BCL_f) {
+            sol[i][0] = SBCL(sol[i][1], sol[i-1][0], sol[i+1][0]);
+        }
+
+        if (bc & BCR_df) {
+            sol[i][m-1] = (ax*(sol[i+1][m-1] + sol[i-1][m-1]) + ay*2*(sol[i][m-2] + hx*right[i]) - (poisson ? f[i][m-1] : 0))/d;
+        }
+
+        if (sbc & BCR_f) {
+            sol[i][m-1] = SBCR(sol[i][m-2], sol[i-1][m-1], sol[i+1][m-1]);
+        }
+    }
+
+    //  Bordes superior e inferior
+    for (size_t j = 1; j < m-1; ++j) {
+        if (bc & BCT_df) {
+            sol[0][j] = (ax*2*(sol[1][j] + hy*top[j]) + ay*(sol[0][j+1] + sol[0][j-1]) - (poisson ? f[0][j] : 0))/d;
+        }
+
+        if (sbc & BCT_f) {
+            sol[0][j] = SBCT(sol[0][j-1], sol[0][j+1], sol[1][j]);
+        }
+
+        if (bc & BCB_df) {
+            sol[n-1][j] = (ax*2*(sol[n-2][j] + hy*bottom[j]) + ay*(sol[n-1][j+1] + sol[n-1][j-1]) - (poisson ? f[n-1][j] : 0))/d;
+        }
+
+        if (sbc & BCB_f) {
+            sol[n-1][j] = SBCB(sol[n-1][j-1], sol[n-1][j+1], sol[n-2][j]);
+        }
+    }
+
+    //  Ajuste de las esquinas
+    if (bc & BCL_df && bc & BCT_df) {
+        sol[0][0] = (2.0*sol[0][1]-sol[0][2] + 2.0*sol[1][0]-sol[2][0])/2.0;
+    }
+
+    if (bc & BCT_df && bc & BCR_df) {
+        sol[0][m-1] = (2.0*sol[0][m-2]-sol[0][m-3] + 2.0*sol[1][m-1]-sol[2][m-1])/2.0;
+    }
+
+    if (bc & BCL_df && bc & BCB_df) {
+        sol[n-1][0] = (2.0*sol[n-1][1]-sol[n-1][2] + 2.0*sol[n-2][0]-sol[n-3][0])/2.0;
+    }
+
+    if (bc & BCB_df && bc & BCR_df) {
+        sol[n-1][m-1] = (2.0*sol[n-1][m-2]-sol[n-1][m-3] + 2.0*sol[n-2][m-1]-sol[n-3][m-1])/2.0;
+    }
+}
+
+void PoissonSolver2D::sweep(Matrix<EDP_T> &sol, const size_t &color, const EDP_T &omega, Vector<EDP_T> &change) const
+{
+    const EDP_T ax = hx*hx, ay = hy*hy;
+    const bool poisson = f.rows() > 0;
+
+    //  Cada hilo hace siempre las mismas filas, así que el segundo color suma sobre change sin carreras
+    parallel::Team::shared().run([&](const parallel::Team::Member &member) {
+        size_t lo, hi;
+        member.range(1, n-1, lo, hi);
+
+        for (size_t i = lo; i < hi; ++i) {
+            const size_t first = ((i + 1) & 1) == color ? 1 : 2;
+            const EDP_T delta = poisson ?
+                relax_row<true>(sol[i-1], sol[i], sol[i+1], f[i], first, m, ax, ay, omega) :
+                relax_row<false>(sol[i-1], sol[i], sol[i+1], nullptr, first, m, ax, ay, omega);
+
+            change[i] = color == 0 ? delta : change[i] + delta;
+        }
+    }, std::max<size_t>(1, n*m / CDA_TEAM_GRAIN));
+}
+
+size_t PoissonSolver2D::gaussSeidel(Matrix<EDP_T> &sol, EDP_T err, size_t tol, size_t stride) const
+{
+    if (sol.rows() != n || sol.columns() != m) {
+        throw std::logic_error("Las dimensiones de sol deben coincidir con las de y, x");
+    }
+
+    stride = std::max<size_t>(stride, 1);
+
+    const EDP_T ax = hx*hx, ay = hy*hy, d = 2.0*(ay + ax);
+    const bool poisson = f.rows() > 0, special = (sbc & BCI_f) != 0;
+
+    //  Suma de |u| en cada fila del interior
+    Vector<EDP_T> sup(n-2), supOld(n-2);
+    const auto sums = [&](Vector<EDP_T> &rows) {
+        for (size_t i = 1; i < n-1; ++i) {
+            EDP_T sum = 0;
+            for (size_t j = 1; j < m-1; ++j) {
+                sum += std::abs(sol[i][j]);
+            }
+            rows[i-1] = sum;
+        }
+    };
+
+    size_t ite = 0;
+    while (ite < tol) {
+        const bool check = (ite + 1) % stride == 0 || ite + 1 == tol;
+        if (check) {
+            sums(supOld);
+        }
+
+        for (size_t i = 1; i < n-1; ++i) {
+            const EDP_T *up = sol[i-1], *down = sol[i+1];
+            EDP_T *row = sol[i];
+
+            if (special) {
+                for (size_t j = 1; j < m-1; ++j) {
+                    row[j] = SBCI(row[j-1], row[j+1], up[j], down[j]);
+                }
+            } else {
+                for (size_t j = 1; j < m-1; ++j) {
+                    row[j] = (ax*(down[j] + up[j]) + ay*(row[j+1] + row[j-1]) - (poisson ? f[i][j] : 0))/d;
+                }
+            }
+        }
+
+        boundaries(sol);
+
+        ++ite;
+        if (check) {
+            sums(sup);
+            if (std::abs(sup.max_element() - supOld.max_element()) < err) {
+                break;
+            }
+        }
+    }
+
+    return ite;
+}
+
+size_t PoissonSolver2D::sor(Matrix<EDP_T> &sol, EDP_T err, size_t tol, EDP_T omega) const
+{
+    if (sol.rows() != n || sol.columns() != m) {
+        throw std::logic_error("Las dimensiones de sol deben coincidir con las de y, x");
+    }
+
+    if (omega <= 0) {
+        omega = optimalOmega();
+    }
+
+    Vector<EDP_T> change(n, 0);
+    size_t ite = 0;
+    while (ite < tol) {
+        sweep(sol, 0, omega, change);
+        sweep(sol, 1, omega, change);
+        boundaries(sol);
+
+        ++ite;
+        if (change.max_element() < err) {
+            break;
+        }
+    }
+
+    return ite;
+}
+
+void PoissonSolver2D::residual(const Matrix<EDP_T> &sol, Matrix<EDP_T> &r) const
+{
+    const EDP_T ax = hx*hx, ay = hy*hy;
+    const bool poisson = f.rows() > 0;
+    const bool l = (bc & BCL_df) && !(sbc & BCL_f), rr = (bc & BCR_df) && !(sbc & BCR_f);
+    const bool t = (bc & BCT_df) && !(sbc & BCT_f), b = (bc & BCB_df) && !(sbc & BCB_f);
+
+    //  ∆u en (i, j) con los vecinos dados. En los bordes con derivada el vecino de fuera es el fantasma
+    //  que usa la pasada de bordes: el simétrico más 2·h·BC
+    const auto equation = [&](const size_t &i, const size_t &j,
+                              const EDP_T &uU, const EDP_T &uD, const EDP_T &uL, const EDP_T &uR) {
+        const EDP_T u = sol[i][j];
+        r[i][j] = (poisson ? f[i][j]/(ax*ay) : 0) - ((uU + uD - 2.0*u)/ay + (uL + uR - 2.0*u)/ax);
+    };
+
+    r.zero();
+
+    parallel::Team::shared().for_each(1, n-1, [&](const size_t &from, const size_t &to) {
+        for (size_t i = from; i < to; ++i) {
+            const EDP_T *up = sol[i-1], *row = sol[i], *down = sol[i+1];
+            for (size_t j = 1; j < m-1; ++j) {
+                equation(i, j, up[j], down[j], row[j-1], row[j+1]);
+            }
+
+            if (l) {
+                equation(i, 0, up[0], down[0], row[1] + 2.0*hx*left[i], row[1]);
+            }
+            if (rr) {
+                equation(i, m-1, up[m-1], down[m-1], row[m-2], row[m-2] + 2.0*hx*right[i]);
+            }
+        }
+    }, row_grain(m));
+
+    for (size_t j = 1; j < m-1; ++j) {
+        if (t) {
+            equation(0, j, sol[1][j] + 2.0*hy*top[j], sol[1][j], sol[0][j-1], sol[0][j+1]);
+        }
+        if (b) {
+            equation(n-1, j, sol[n-2][j], sol[n-2][j] + 2.0*hy*bottom[j], sol[n-1][j-1], sol[n-1][j+1]);
+        }
+    }
+}
+
+EDP_T PoissonSolver2D::residual(const Matrix<EDP_T> &sol) const
+{
+    Matrix<EDP_T> r(n, m);
+    residual(sol, r);
+    return r.abs_max_element()*hx*hx*hy*hy/(2.0*(hx*hx + hy*hy));
+}
+
+void PoissonSolver2D::vcycle(std::vector<Level> &levels, const size_t &k)
+{
+    Level &level = levels[k];
+
+    //  La malla más gruesa se resuelve con SOR: el número de barridos crece con su tamaño
+    if (k + 1 == levels.size()) {
+        const EDP_T kx = M_PI/(2.0*(level.m - 1)), ky = M_PI/(2.0*(level.n - 1));
+        const EDP_T ax = level.hx*level.hx, ay = level.hy*level.hy;
+        const EDP_T rho = (ay*std::cos(kx) + ax*std::cos(ky))/(ax + ay);
+        level.smooth(4*std::max(level.n, level.m), 2.0/(1.0 + std::sqrt(1.0 - rho*rho)));
+        return;
+    }
+
+    Level &coarse = levels[k+1];
+
+    level.smooth(2, 1.0);
+    level.residual();
+
+    restrict_full(level.res, coarse.r, coarse.rows, coarse.columns);
+    coarse.e.zero();
+    vcycle(levels, k+1);
+    prolong_add(coarse.e, level.e, coarse.rows, coarse.columns);
+
+    level.smooth(2, 1.0);
+}
+
+size_t PoissonSolver2D::multigrid(Matrix<EDP_T> &sol, EDP_T err, size_t tol, std::vector<EDP_T> *residuals) const
+{
+    if (sol.rows() != n || sol.columns() != m) {
+        throw std::logic_error("Las dimensiones de sol deben coincidir con las de y, x");
+    }
+
+    //  Mallas gruesas. Los bordes especiales se tratan como fijos
+    const Level fine(n, m, hx, hy, (bc & BCL_df) && !(sbc & BCL_f), (bc & BCR_df) && !(sbc & BCR_f),
+                     (bc & BCT_df) && !(sbc & BCT_f), (bc & BCB_df) && !(sbc & BCB_f));
+    std::vector<Level> levels;
+    if (fine.coarsens()) {
+        levels.push_back(fine.coarse());
+        while (levels.back().coarsens()) {
+            levels.push_back(levels.back().coarse());
+        }
+    }
+
+    Matrix<EDP_T> r(n, m);
+    Vector<EDP_T> change(n, 0);
+    const EDP_T scale = hx*hx*hy*hy/(2.0*(hx*hx + hy*hy));
+
+    //  La malla fina se suaviza con los barridos y la pasada de bordes de sor()
+    const auto smooth = [&]() {
+        for (size_t sweep = 0; sweep < 2; ++sweep) {
+            this->sweep(sol, 0, 1.0, change);
+            this->sweep(sol, 1, 1.0, change);
+            boundaries(sol);
+        }
+    };
+
+    size_t cycles = 0;
+    while (cycles < tol) {
+        smooth();
+
+        if (!levels.empty()) {
+            residual(sol, r);
+            restrict_full(r, levels[0].r, levels[0].rows, levels[0].columns);
+            levels[0].e.zero();
+            vcycle(levels, 0);
+            prolong_add(levels[0].e, sol, levels[0].rows, levels[0].columns);
+            dirichlet(sol);
+        }
+
+        smooth();
+
+        ++cycles;
+        residual(sol, r);
+        const EDP_T norm = r.abs_max_element()*scale;
+        if (residuals) {
+            residuals->push_back(norm);
+        }
+        if (norm < err) {
+            break;
+        }
+    }
+
+    return cycles;
+}
+
+bool PoissonSolver2D::separable() const
+{
+    return sbc == 0 &&
+        ((bc & BCL_df) != 0) == ((bc & BCR_df) != 0) &&
+        ((bc & BCT_df) != 0) == ((bc & BCB_df) != 0);
+}
+
+void PoissonSolver2D::fourier(Matrix<EDP_T> &sol) const
+{
+    if (sol.rows() != n || sol.columns() != m) {
+        throw std::logic_error("Las dimensiones de sol deben coincidir con las de y, x");
+    }
+
+    if (!separable()) {
+        throw std::logic_error("PoissonSolver2D::fourier necesita, en cada dirección, derivada en los dos bordes o en ninguno, y ninguna condición especial");
+    }
+
+    const EDP_T ax = hx*hx, ay = hy*hy;
+    const bool poisson = f.rows() > 0;
+
+    //  Con derivada los bordes son incógnitas; si no, valores fijos
+    const bool nx = (bc & BCL_df) != 0, ny = (bc & BCT_df) != 0;
+    const size_t i0 = ny ? 0 : 1, j0 = nx ? 0 : 1;
+    const size_t rows = ny ? n : n-2, cols = nx ? m : m-2;
+
+    const Transform X(nx ? Transform::cosine : Transform::sine, cols);
+    const Transform Y(ny ? Transform::cosine : Transform::sine, rows);
+
+    //  Término independiente de ∆u = F: los valores fijos y las derivadas de los bordes pasan a la derecha
+    Matrix<EDP_T> g(rows, cols), t(cols, rows);
+    parallel::Team::shared().for_each(0, rows, [&](const size_t &from, const size_t &to) {
+        for (size_t r = from; r < to; ++r) {
+            const size_t i = r + i0;
+            for (size_t c = 0; c < cols; ++c) {
+                const size_t j = c + j0;
+                EDP_T rhs = poisson ? f[i][j]/(ax*ay) : 0;
+
+                if (nx) {
+                    rhs -= (j == 0 ? 2.0*left[i]/hx : 0) + (j == m-1 ? 2.0*right[i]/hx : 0);
+                } else {
+                    rhs -= (j == 1 ? sol[i][0]/ax : 0) + (j == m-2 ? sol[i][m-1]/ax : 0);
+                }
+
+                if (ny) {
+                    rhs -= (i == 0 ? 2.0*top[j]/hy : 0) + (i == n-1 ? 2.0*bottom[j]/hy : 0);
+                } else {
+                    rhs -= (i == 1 ? sol[0][j]/ay : 0) + (i == n-2 ? sol[n-1][j]/ay : 0);
+                }
+
+                g[r][c] = rhs;
+            }
+        }
+    }, row_grain(m));
+
+    //  Con derivada en los cuatro bordes, el modo constante de la solución inicial (pesos 1/2 en los bordes)
+    EDP_T constant = 0;
+    if (nx && ny) {
+        for (size_t i = 0; i < n; ++i) {
+            const EDP_T wy = (i == 0 || i == n-1) ? 0.5 : 1.0;
+            for (size_t j = 0; j < m; ++j) {
+                constant += wy*((j == 0 || j == m-1) ? 0.5 : 1.0)*sol[i][j];
+            }
+        }
+    }
+
+    //  Coeficientes en la base de autovectores del laplaciano discreto, divididos por sus autovalores
+    transform_rows(g, X);
+    transpose(g, t);
+    transform_rows(t, Y);
+
+    parallel::Team::shared().for_each(0, cols, [&](const size_t &from, const size_t &to) {
+        for (size_t k = from; k < to; ++k) {
+            const EDP_T lx = X.eigenvalue(k)/ax;
+            for (size_t l = 0; l < rows; ++l) {
+                t[k][l] = (nx && ny && k == 0 && l == 0) ? constant : t[k][l]/(lx + Y.eigenvalue(l)/ay);
+            }
+        }
+    }, row_grain(rows));
+
+    transform_rows(t, Y);
+    transpose(t, g);
+    transform_rows(g, X);
+
+    const EDP_T scale = 1.0/(X.scale()*Y.scale());
+    parallel::Team::shared().for_each(0, rows, [&](const size_t &from, const size_t &to) {
+        for (size_t r = from; r < to; ++r) {
+            for (size_t c = 0; c < cols; ++c) {
+                sol[r + i0][c + j0] = g[r][c]*scale;
+            }
+        }
+    }, row_grain(m));
+}
+
+bool PoissonSolver2D::symmetric() const
+{
+    return sbc == 0 && (bc & (BCL_df | BCR_df | BCT_df | BCB_df)) == 0;
+}
+
+EDP_T PoissonSolver2D::apply(const Matrix<EDP_T> &p, Matrix<EDP_T> &q) const
+{
+    const EDP_T ax = hx*hx, ay = hy*hy, d = 2.0*(ax + ay);
+
+    return reduce_rows(1, n-1, m, [&](const size_t &from, const size_t &to) {
+        Reduction result = {0, 0};
+        for (size_t i = from; i < to; ++i) {
+            const EDP_T *up = p[i-1], *row = p[i], *down = p[i+1];
+            EDP_T *out = q[i];
+            for (size_t j = 1; j < m-1; ++j) {
+                out[j] = d*row[j] - ax*(up[j] + down[j]) - ay*(row[j-1] + row[j+1]);
+                result.sum += row[j]*out[j];
+            }
+        }
+        return result;
+    }).sum;
+}
+
+void PoissonSolver2D::precondition(const Preconditioner &preconditioner, const EDP_T &omega,
+                                   const Matrix<EDP_T> &diagonal, const Matrix<EDP_T> &r, Matrix<EDP_T> &z) const
+{
+    const EDP_T ax = hx*hx, ay = hy*hy, d = 2.0*(ax + ay);
+
+    //  Pasada de un color de SSOR: z = a·z + (b·r + ω·(hx²·(zT + zB) + hy²·(zL + zR)))/d
+    const auto pass = [&](const size_t &color, const EDP_T &a, const EDP_T &b) {
+        parallel::Team::shared().for_each(1, n-1, [&](const size_t &from, const size_t &to) {
+            for (size_t i = from; i < to; ++i) {
+                const EDP_T *up = z[i-1], *down = z[i+1], *rhs = r[i];
+                EDP_T *row = z[i];
+                for (size_t j = ((i + 1 + color) & 1) ? 2 : 1; j < m-1; j += 2) {
+                    row[j] = a*row[j] + (b*rhs[j] + omega*(ax*(up[j] + down[j]) + ay*(row[j-1] + row[j+1])))/d;
+                }
+            }
+        }, row_grain(m));
+    };
+
+    switch (preconditioner) {
+        case none:
+            z = r;
+            break;
+
+        case jacobi:
+            parallel::Team::shared().for_each(1, n-1, [&](const size_t &from, const size_t &to) {
+                for (size_t i = from; i < to; ++i) {
+                    for (size_t j = 1; j < m-1; ++j) {
+                        z[i][j] = r[i][j]/d;
+                    }
+                }
+            }, row_grain(m));
+            break;
+
+        case ssor:
+            //  (D/ω + L)·y = r con los puntos rojos (i+j par) primero y (D/ω + U)·z = (2-ω)/ω·D·y después.
+            //  En cada color los puntos sólo dependen del otro, así que cada pasada es paralela
+            z.zero();
+            pass(0, 0, omega);
+            pass(1, 0, omega);
+            parallel::Team::shared().for_each(1, n-1, [&](const size_t &from, const size_t &to) {
+                for (size_t i = from; i < to; ++i) {
+                    for (size_t j = (i & 1) ? 2 : 1; j < m-1; j += 2) {
+                        z[i][j] *= 2.0 - omega;
+                    }
+                }
+            }, row_grain(m));
+            pass(0, 2.0 - omega, 0);
+            break;
+
+        case cholesky:
+            //  (Δ + L)·Δ⁻¹·(Δ + Lᵀ)·z = r, con L la parte inferior de A en orden lexicográfico
+            for (size_t i = 1; i < n-1; ++i) {
+                for (size_t j = 1; j < m-1; ++j) {
+                    z[i][j] = (r[i][j] + ax*z[i-1][j] + ay*z[i][j-1])/diagonal[i][j];
+                }
+            }
+            for (size_t i = n-2; i > 0; --i) {
+                for (size_t j = m-2; j > 0; --j) {
+                    z[i][j] += (ax*z[i+1][j] + ay*z[i][j+1])/diagonal[i][j];
+                }
+            }
+            break;
+    }
+}
+
+size_t PoissonSolver2D::conjugateGradient(Matrix<EDP_T> &sol, EDP_T err, size_t tol, Preconditioner preconditioner,
+                                          EDP_T omega, std::vector<EDP_T> *residuals) const
+{
+    if (sol.rows() != n || sol.columns() != m) {
+        throw std::logic_error("Las dimensiones de sol deben coincidir con las de y, x");
+    }
+
+    if (!symmetric()) {
+        throw std::logic_error("PoissonSolver2D::conjugateGradient necesita que todos los bordes sean fijos");
+    }
+
+    if (omega <= 0) {
+        omega = 1;
+    }
+
+    const EDP_T ax = hx*hx, ay = hy*hy, d = 2.0*(ax + ay);
+    const bool poisson = f.rows() > 0;
+
+    //  Los bordes de r, z, p y q son 0: los valores fijos sólo entran en el residuo inicial
+    Matrix<EDP_T> r(n, m, 0), p(n, m, 0), q(n, m, 0), z, diagonal;
+    if (preconditioner != none) {
+        z = Matrix<EDP_T>(n, m, 0);
+    }
+    Matrix<EDP_T> &y = preconditioner == none ? r : z;
+
+    //  Diagonal del factor de Cholesky incompleto: sólo se pierde el relleno
+    if (preconditioner == cholesky) {
+        diagonal = Matrix<EDP_T>(n, m, 0);
+        for (size_t i = 1; i < n-1; ++i) {
+            for (size_t j = 1; j < m-1; ++j) {
+                diagonal[i][j] = d - (i > 1 ? ax*ax/diagonal[i-1][j] : 0) - (j > 1 ? ay*ay/diagonal[i][j-1] : 0);
+            }
+        }
+    }
+
+    //  r = b - A·sol, con b = -hx²·hy²·F
+    EDP_T norm = reduce_rows(1, n-1, m, [&](const size_t &from, const size_t &to) {
+        Reduction result = {0, 0};
+        for (size_t i = from; i < to; ++i) {
+            const EDP_T *up = sol[i-1], *row = sol[i], *down = sol[i+1];
+            for (size_t j = 1; j < m-1; ++j) {
+                r[i][j] = -(poisson ? f[i][j] : 0) - (d*row[j] - ax*(up[j] + down[j]) - ay*(row[j-1] + row[j+1]));
+                result.max = std::max(result.max, std::abs(r[i][j]));
+            }
+        }
+        return result;
+    }).max/d;
+
+    if (preconditioner != none) {
+        precondition(preconditioner, omega, diagonal, r, z);
+    }
+    EDP_T rz = reduce_rows(1, n-1, m, [&](const size_t &from, const size_t &to) {
+        Reduction result = {0, 0};
+        for (size_t i = from; i < to; ++i) {
+            for (size_t j = 1; j < m-1; ++j) {
+                p[i][j] = y[i][j];
+                result.sum += r[i][j]*y[i][j];
+            }
+        }
+        return result;
+    }).sum;
+
+    size_t ite = 0;
+    while (ite < tol && norm >= err) {
+        const EDP_T alpha = rz/apply(p, q);
+
+        //  sol += α·p y r -= α·q. Sin precondicionador, r·r sale en la misma pasada
+        const Reduction update = reduce_rows(1, n-1, m, [&](const size_t &from, const size_t &to) {
+            Reduction result = {0, 0};
+            for (size_t i = from; i < to; ++i) {
+                for (size_t j = 1; j < m-1; ++j) {
+                    sol[i][j] += alpha*p[i][j];
+                    r[i][j] -= alpha*q[i][j];
+                    result.sum += r[i][j]*r[i][j];
+                    result.max = std::max(result.max, std::abs(r[i][j]));
+                }
+            }
+            return result;
+        });
+
+        ++ite;
+        norm = update.max/d;
+        if (residuals) {
+            residuals->push_back(norm);
+        }
+        if (norm < err) {
+            break;
+        }
+
+        EDP_T rzNew = update.sum;
+        if (preconditioner != none) {
+            precondition(preconditioner, omega, diagonal, r, z);
+            rzNew = reduce_rows(1, n-1, m, [&](const size_t &from, const size_t &to) {
+                Reduction result = {0, 0};
+                for (size_t i = from; i < to; ++i) {
+                    for (size_t j = 1; j < m-1; ++j) {
+                        result.sum += r[i][j]*z[i][j];
+                    }
+                }
+                return result;
+            }).sum;
+        }
+
+        const EDP_T beta = rzNew/rz;
+        rz = rzNew;
+        parallel::Team::shared().for_each(1, n-1, [&](const size_t &from, const size_t &to) {
+            for (size_t i = from; i < to; ++i) {
+                for (size_t j = 1; j < m-1; ++j) {
+                    p[i][j] = y[i][j] + beta*p[i][j];
+                }
+            }
+        }, row_grain(m));
+    }
+
+    return ite;
+}
+
+EDP_T PoissonSolver2D::optimalOmega() const
+{
+    const EDP_T ax = hx*hx, ay = hy*hy;
+
+    //  Modo más lento de Jacobi: medio periodo en la malla, o un cuarto si algún borde es de derivada
+    const EDP_T kx = M_PI/((bc & (BCL_df | BCR_df)) ? 2.0*(m-1) : (m-1));
+    const EDP_T ky = M_PI/((bc & (BCT_df | BCB_df)) ? 2.0*(n-1) : (n-1));
+    const EDP_T rho = (ay*std::cos(kx) + ax*std::cos(ky))/(ax + ay);
+
+    return 2.0/(1.0 + std::sqrt(1.0 - rho*rho));
+}
@@ -0,0 +1,214 @@
+//
+//  PoissonSolver2D.h
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <vector>
+
+#include "SolveEDP.h"
+
+
+namespace cda {
+    namespace math {
+        namespace differential_equations {
+
+            //  -- ECUACIONES DE LAPLACE Y POISSON EN 2 DIMENSIONES --
+            //  Resuelve ∆u = F con la discretización y las condiciones de contorno de EDP::solveLAPLACE y
+            //  EDP::solvePOISSON: los bordes con BCx_f toman el valor de la función, los bordes con BCx_df
+            //  cumplen la condición en la derivada y los bordes sin condición no cambian. Las condiciones
+            //  especiales SBCx de los bordes se aplican también en la pasada de bordes, y la del interior
+            //  (SBCI) sólo en gaussSeidel().
+            //
+            //  F y las condiciones de contorno se muestrean al construirlo, así que los barridos no llaman
+            //  a ninguna función salvo a las condiciones especiales.
+            class PoissonSolver2D {
+            public:
+
+                //  Precondicionadores de conjugateGradient()
+                enum Preconditioner {
+                    none,           //  Gradiente conjugado sin precondicionar
+                    jacobi,         //  Diagonal
+                    ssor,           //  SSOR rojo-negro, en paralelo
+                    cholesky        //  Cholesky incompleto sin relleno, IC(0), en orden lexicográfico
+                };
+
+                /**
+                 @param equation Ecuación de la que se toman BCL, BCR, BCT, BCB, SBCL, SBCR, SBCT, SBCB y F
+                 @param bc Condiciones de contorno (BCx_f y BCx_df)
+                 @param sbc Condiciones especiales de los bordes (BCx_f). BCI_f sólo la usa gaussSeidel()
+                 @param x Coordenadas de las columnas
+                 @param y Coordenadas de las filas
+                 @param poisson Si es false, F = 0 (ecuación de Laplace) y no se llama a equation.F
+                 */
+                PoissonSolver2D(const EDP &equation, unsigned char bc, unsigned char sbc,
+                                const containers::Vector<EDP_T> &x, const containers::Vector<EDP_T> &y,
+                                bool poisson);
+
+                /**
+                 Escribe en sol los bordes con BCx_f
+                 */
+                void dirichlet(containers::Matrix<EDP_T> &sol) const;
+
+                /**
+                 Pasada de bordes: actualiza los bordes con BCx_df o con condición especial y las esquinas
+                 a partir de los valores actuales del interior
+                 */
+                void boundaries(containers::Matrix<EDP_T> &sol) const;
+
+                /**
+                 Gauss-Seidel en orden lexicográfico, el método por defecto de EDP::solveLAPLACE. Cada iteración
+                 es un barrido del interior seguido de la pasada de bordes. Termina cuando la mayor suma de |u|
+                 de una fila del interior cambia menos de err entre dos iteraciones
+
+                 @param sol Solución inicial con los bordes ya fijados (dirichlet()). Se sobrescribe
+                 @param tol Número máximo de iteraciones
+                 @param stride Cada cuántas iteraciones se comprueba la convergencia (y siempre en la última)
+                 @return Número de iteraciones
+                 */
+                size_t gaussSeidel(containers::Matrix<EDP_T> &sol, EDP_T err, size_t tol, size_t stride = 1) const;
+
+                /**
+                 Sobrerrelajación sucesiva con ordenación rojo-negro. Cada color se reparte por filas entre
+                 los hilos de parallel::Team::shared(), porque los puntos de un color sólo leen los del otro.
+                 Termina cuando la mayor variación de una fila en un barrido (suma de |∆u|) baja de err,
+                 que es más estricto que el criterio de EDP::solveLAPLACE
+
+                 @param sol Solución inicial con los bordes ya fijados (dirichlet()). Se sobrescribe
+                 @param tol Número máximo de barridos
+                 @param omega Factor de relajación. Con 0 se usa optimalOmega()
+                 @return Número de barridos
+                 */
+                size_t sor(containers::Matrix<EDP_T> &sol, EDP_T err, size_t tol, EDP_T omega = 0) const;
+
+                /**
+                 Multigrid geométrico con ciclos V: dos barridos rojo-negro de Gauss-Seidel antes y después de
+                 corregir con el error calculado en una malla con la mitad de intervalos, recursivamente.
+                 El coste de un ciclo es proporcional al número de puntos y el número de ciclos no depende de la malla.
+
+                 Con un número impar de intervalos la malla gruesa tiene uno más de la mitad y no está anidada en la
+                 fina: restricción y prolongación usan interpolación lineal. La malla más gruesa se resuelve con SOR.
+                 Los bordes con BCx_df se mantienen como incógnitas en las mallas gruesas; los bordes especiales sólo
+                 se actualizan en la fina
+
+                 @param sol Solución inicial con los bordes ya fijados (dirichlet()). Se sobrescribe
+                 @param err Residuo (residual()) por debajo del que se para
+                 @param tol Número máximo de ciclos
+                 @param residuals Si no es nullptr, se añade el residuo al final de cada ciclo
+                 @return Número de ciclos
+                 */
+                size_t multigrid(containers::Matrix<EDP_T> &sol, EDP_T err, size_t tol,
+                                 std::vector<EDP_T> *residuals = nullptr) const;
+
+                /**
+                 Solución directa con transformadas rápidas de senos (DST-I) y cosenos (DCT-I), en O(N log N).
+                 La discretización es separable si no hay condiciones especiales y, en cada dirección, los dos
+                 bordes tienen condición en la derivada o ninguno la tiene: los bordes con BCx_f o sin condición
+                 son valores fijos. Da la solución exacta de las ecuaciones de sor() salvo en las esquinas con
+                 derivada en los dos bordes, que cumplen la ecuación con los dos puntos fantasma en lugar de
+                 extrapolarse.
+
+                 Con derivada en los cuatro bordes la solución se define salvo una constante, que se toma de
+                 la solución inicial, y se descarta la parte de F que no cumple la condición de compatibilidad
+
+                 @param sol Solución inicial con los bordes ya fijados (dirichlet()). Se sobrescribe
+                 @throw std::logic_error Si las condiciones de contorno no son separables (separable())
+                 */
+                void fourier(containers::Matrix<EDP_T> &sol) const;
+
+                /**
+                 Indica si fourier() admite las condiciones de contorno
+                 */
+                bool separable() const;
+
+                /**
+                 Gradiente conjugado sin matriz: el operador se aplica con la plantilla de 5 puntos sobre la malla.
+                 Las ecuaciones sólo son simétricas (definidas positivas) si todos los bordes son fijos (symmetric()).
+                 Los productos escalares y las aplicaciones del operador se reparten por filas entre los hilos de
+                 parallel::Team::shared(), como los demás métodos, y no en ThreadPool::shared(): cada miembro recibe
+                 siempre las mismas filas, así que las sumas parciales se combinan en el mismo orden (el resultado no
+                 depende de los hilos) y sus filas siguen en su caché. El precondicionador de Cholesky incompleto es
+                 secuencial
+
+                 @param sol Solución inicial con los bordes ya fijados (dirichlet()). Se sobrescribe
+                 @param err Residuo (residual()) por debajo del que se para
+                 @param tol Número máximo de iteraciones
+                 @param preconditioner Precondicionador
+                 @param omega Factor de relajación del precondicionador ssor. Con 0 se usa 1 (Gauss-Seidel simétrico)
+                 @param residuals Si no es nullptr, se añade el residuo al final de cada iteración
+                 @return Número de iteraciones
+                 @throw std::logic_error Si las ecuaciones no son simétricas
+                 */
+                size_t conjugateGradient(containers::Matrix<EDP_T> &sol, EDP_T err, size_t tol,
+                                         Preconditioner preconditioner = none, EDP_T omega = 0,
+                                         std::vector<EDP_T> *residuals = nullptr) const;
+
+                /**
+                 Indica si conjugateGradient() admite las condiciones de contorno: ningún borde con derivada
+                 ni con condición especial
+                 */
+                bool symmetric() const;
+
+                /**
+                 Mayor residuo de las ecuaciones de los puntos libres, en unidades de u: lo que cambiaría ese punto
+                 en un barrido de Gauss-Seidel (|F - ∆u|·hx²·hy²/(2(hx² + hy²)))
+                 */
+                EDP_T residual(const containers::Matrix<EDP_T> &sol) const;
+
+                /**
+                 Factor de relajación óptimo para el laplaciano en esta malla: 2/(1 + √(1 - ρ²)), con ρ el radio
+                 espectral de Jacobi. Un borde con condición en la derivada equivale a duplicar la malla en esa dirección
+                 */
+                EDP_T optimalOmega() const;
+
+                size_t rows() const { return n; }
+                size_t columns() const { return m; }
+
+            private:
+
+                //  Malla gruesa del multigrid: error e y residuo r de la malla anterior
+                struct Level;
+
+                //  Residuo F - ∆u en cada punto libre de la malla fina (0 en el resto)
+                void residual(const containers::Matrix<EDP_T> &sol, containers::Matrix<EDP_T> &r) const;
+
+                //  q = A·p en el interior, con A·u = 2(hx² + hy²)·u - hx²·(uT + uB) - hy²·(uL + uR).
+                //  Devuelve p·q. Los bordes de p deben ser 0
+                EDP_T apply(const containers::Matrix<EDP_T> &p, containers::Matrix<EDP_T> &q) const;
+
+                //  z = M⁻¹·r. diagonal es la diagonal del factor de Cholesky incompleto
+                void precondition(const Preconditioner &preconditioner, const EDP_T &omega,
+                                  const containers::Matrix<EDP_T> &diagonal,
+                                  const containers::Matrix<EDP_T> &r, containers::Matrix<EDP_T> &z) const;
+
+                //  Ciclo V desde la malla gruesa k
+                static void vcycle(std::vector<Level> &levels, const size_t &k);
+
+                //  Pasada de un color (0: i+j par, 1: impar). Devuelve la suma de |∆u| de cada fila en change
+                void sweep(containers::Matrix<EDP_T> &sol, const size_t &color, const EDP_T &omega,
+                           containers::Vector<EDP_T> &change) const;
+
+                size_t n, m;
+                EDP_T hx, hy;
+                unsigned char bc, sbc;
+
+                EDP_T (* SBCL)(EDP_T uR, EDP_T uT, EDP_T uB);
+                EDP_T (* SBCR)(EDP_T uL, EDP_T uT, EDP_T uB);
+                EDP_T (* SBCT)(EDP_T uL, EDP_T uR, EDP_T uB);
+                EDP_T (* SBCB)(EDP_T uL, EDP_T uR, EDP_T uT);
+                EDP_T (* SBCI)(EDP_T uL, EDP_T uR, EDP_T uT, EDP_T uB);
+
+                //  hx²·hy²·F en cada punto. Vacía para Laplace
+                containers::Matrix<EDP_T> f;
+
+                //  Condiciones de contorno muestreadas en cada borde
+                containers::Vector<EDP_T> left, right, top, bottom;
+            };
+
+        } /* namespace differential_equations */
+    } /* namespace math */
+} /* namespace cda */
@@ -0,0 +1,38 @@
+//
+//  Precision.h
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+
+namespace cda {
+    namespace math {
+        namespace differential_equations {
+
+            //  -- PRECISIÓN DE LOS SOLVERS --
+            //  value_type es el tipo de las mallas que se guardan y se leen en cada paso.
+            //  compute_type es el tipo en el que se hacen las operaciones de cada punto.
+            //
+            //  Las coordenadas, el tiempo y el paso de tiempo siempre son EDP_T.
+            template <typename Storage, typename Accumulator = Storage>
+            struct Precision {
+                typedef Storage value_type;
+                typedef Accumulator compute_type;
+            };
+
+            //  Por defecto: todo en double
+            typedef Precision<double> DoublePrecision;
+
+            //  Todo en float: mitad de memoria por paso y el doble de puntos por vector
+            typedef Precision<float> SinglePrecision;
+
+            //  Mallas en float y operaciones en double
+            typedef Precision<float, double> MixedPrecision;
+
+        } /* namespace differential_equations */
+    } /* namespace math */
+} /* namespace cda */
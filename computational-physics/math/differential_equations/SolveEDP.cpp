@@ -7,6 +7,10 @@
 //
 
 #include "SolveEDP.h"
+#include "WaveSolver2D.h"
+#include "DistributedWaveSolver2D.h"
+#include "PoissonSolver2D.h"
+#include "TemporalBlocking.h"
 
 #include "../containers.hpp"
 #include "../equations/systems/linear.hpp"
@@ -28,6 +32,10 @@ bool initEDP = false;
 const std::string EDPwarning = "\n[EDP::";
 
 
+EDP::EDP() = default;
+EDP::~EDP() = default;
+
+
 //  --- ECUACIONES DIFERENCIALES EN DERIVADAS PARCIALES ---
 
 //  -- MÉTODO DE LAS DIFERENCIAS FINITAS - SISTEMAS DE 1 DIMENSIÓN --
@@ -171,15 +179,61 @@ Vector<EDP_T> EDP::solveDIF_FIN(unsigned char bc, unsigned char opt, Vector<EDP_
 //  -- ECUACIONES DE LAPLACE Y POISSON - SISTEMAS DE 2 DIMENSIONES --
 //  Resuelve las ecuaciones diferenciales: ∆U(x,y) = 0 y ∆U(x,y) = F, F ≠ F(U)
 
+//  ECUACIONES DE LAPLACE Y POISSON
+//  Método de resolución común a solveLAPLACE y solvePOISSON
+int EDP::solveSYSTEM(bool poisson, const char *label, unsigned char bc, unsigned char sbc, unsigned char opt, Vector<EDP_T>& x, Vector<EDP_T>& y, Matrix<EDP_T>& sol, EDP_T err, int tol)
+{
+    int ite = 0;
+    
+    //  Sobrerrelajación rojo-negro, multigrid, transformadas rápidas o gradiente conjugado. La condición especial del interior sólo admite Gauss-Seidel
+    if (method == SORmethod && (sbc& BCI_f) == 0) {
+        ite = (int)PoissonSolver2D(*this, bc, sbc, x, y, poisson).sor(sol, err, tol, omega);
+    } else if (method == MGmethod && (sbc& BCI_f) == 0) {
+        std::vector<EDP_T> residuals;
+        ite = (int)PoissonSolver2D(*this, bc, sbc, x, y, poisson).multigrid(sol, err, tol, &residuals);
+
+        if ((opt& ITERATIONS) != 0) {
+            for (size_t k = 0; k < residuals.size(); ++k) {
+                std::cout << " [Información " << label << "]: Residuo tras el ciclo " << k+1 << ": " << std::scientific << residuals[k] << "\n";
+            }
+        }
+    } else if (method == FFTmethod && (sbc& BCI_f) == 0) {
+        PoissonSolver2D solver(*this, bc, sbc, x, y, poisson);
+        if (solver.separable()) {
+            solver.fourier(sol);
+        } else {
+            //  Derivada en un solo borde de una dirección o condiciones especiales
+            std::cout << "\n [Información " << label << "]: Las condiciones de contorno no son separables, se usa sobrerrelajación en lugar de transformadas.\n\n";
+            ite = (int)solver.sor(sol, err, tol, omega);
+        }
+    } else if (method >= CGmethod && method <= PCGICmethod && (sbc& BCI_f) == 0) {
+        const PoissonSolver2D::Preconditioner preconditioners[] = {
+            PoissonSolver2D::none, PoissonSolver2D::jacobi, PoissonSolver2D::ssor, PoissonSolver2D::cholesky
+        };
+        PoissonSolver2D solver(*this, bc, sbc, x, y, poisson);
+        if (solver.symmetric()) {
+            ite = (int)solver.conjugateGradient(sol, err, tol, preconditioners[method - CGmethod], omega);
+        } else {
+            //  Los bordes con derivada o condición especial rompen la simetría
+            std::cout << "\n [Información " << label << "]: Las ecuaciones no son simétricas, se usa sobrerrelajación en lugar de gradiente conjugado.\n\n";
+            ite = (int)solver.sor(sol, err, tol, omega);
+        }
+    } else {
+        ite = (int)PoissonSolver2D(*this, bc, sbc, x, y, poisson).gaussSeidel(sol, err, tol, checkStride);
+    }
+    
+    return ite;
+}
+
+
 //  ECUACIÓN DE LAPLACE
 //  Función principal / Método de resolución
 Matrix<EDP_T> EDP::solveLAPLACE(unsigned char bc, unsigned char sbc, unsigned char opt, Vector<EDP_T>& x, Vector<EDP_T>& y, Matrix<EDP_T>& cI, EDP_T err, int tol)
 {
     int n = cI.rows(), m = cI.columns();
-    EDP_T hx = (EDP_T)(x[m-1]-x[0])/(m-1), hy = (EDP_T)(y[n-1]-y[0])/(n-1);
-    Matrix<EDP_T> sol(n,m), solOld(n,m);
+    Matrix<EDP_T> sol(n,m);
     
-    sol = solOld = cI;
+    sol = cI;
     
     //  Condiciones en los extremos superior e inferior (Condiciones en la función)
     for (int i=0; i<m; i++) {
@@ -201,90 +255,7 @@ Matrix<EDP_T> EDP::solveLAPLACE(unsigned char bc, unsigned char sbc, unsigned ch
     }
     
     //  Solución de la ecuación de Poisson
-    int ite = 0;
-    EDP_T sum, sumOld, relErr;
-    Vector<EDP_T> sup(m-2), supOld(m-2);
-    
-    //  Solución de la ecuación - Condiciones de contorno normales
-    for (int k=0; k<tol; k++) {
-        for (int i=1; i<n-1; i++) {
-            sum = sumOld = 0.0;
-            for (int j=1; j<m-1; j++) {
-                //  Condiciones de contorno del borde izquierdo
-                if (bc & BCL_df) {
-                    sol[i][0] = (hx*hx*(sol[i+1][0] + sol[i-1][0]) + hy*hy*2*(sol[i][1] + hx*BCL(x[0],y[i])))/(2.0*(hy*hy+hx*hx));
-                }
-                
-                if (sbc & BCL_f) {
-                    sol[i][0] = SBCL(sol[i][1], sol[i-1][0], sol[i+1][0]);
-                }
-                
-                //  Condiciones de contorno del borde superior
-                if (bc & BCT_df) {
-                    sol[0][j] = (hx*hx*2*(sol[1][j] + hy*BCT(x[j],y[0])) + hy*hy*(sol[0][j+1] + sol[0][j-1]))/(2.0*(hy*hy+hx*hx));
-                }
-                
-                if (sbc & BCT_f) {
-                    sol[0][j] = SBCT(sol[0][j-1], sol[0][j+1], sol[1][j]);
-                }
-                
-                //  Condiciones de contorno del interior
-                if (sbc & BCI_f) {
-                    sol[i][j] = SBCI(sol[i][j-1], sol[i][j+1], sol[i-1][j], sol[i+1][j]);
-                } else {
-                    sol[i][j] = (hx*hx*(sol[i+1][j] + sol[i-1][j]) + hy*hy*(sol[i][j+1] + sol[i][j-1]))/(2.0*(hy*hy+hx*hx));
-                }
-                
-                //  Condiciones de contorno del borde inferior
-                if (bc & BCB_df) {
-                    sol[n-1][j] = (hx*hx*2*(sol[n-2][j] + hy*BCB(x[j],y[n-1])) + hy*hy*(sol[n-1][j+1] + sol[n-1][j-1]))/(2.0*(hy*hy+hx*hx));
-                }
-                
-                if (sbc & BCB_f) {
-                    sol[n-1][j] = SBCB(sol[n-1][j-1], sol[n-1][j+1], sol[n-2][j]);
-                }
-                
-                //  Condiciones de contorno del borde derecho
-                if (bc & BCR_df) {
-                    sol[i][m-1] = (hx*hx*(sol[i+1][m-1] + sol[i-1][m-1]) + hy*hy*2*(sol[i][m-2] + hx*BCR(x[m-1],y[i])))/(2.0*(hy*hy+hx*hx));
-                }
-                
-                if (sbc & BCR_f) {
-                    sol[i][m-1] = SBCR(sol[i][m-2], sol[i-1][m-1], sol[i+1][m-1]);
-                }
-                
-                //  Ajuste de las esquinas
-                if (bc & BCL_df && bc & BCT_df) {
-                    sol[0][0] = (2.0*sol[0][1]-sol[0][2] + 2.0*sol[1][0]-sol[2][0])/2.0;
-                }
-                
-                if (bc & BCT_df && bc & BCR_df) {
-                    sol[0][m-1] = (2.0*sol[0][m-2]-sol[0][m-3] + 2.0*sol[1][m-1]-sol[2][m-1])/2.0;
-                }
-                
-                if (bc & BCL_df && bc & BCB_df) {
-                    sol[n-1][0] = (2.0*sol[n-1][1]-sol[n-1][2] + 2.0*sol[n-2][0]-sol[n-3][0])/2.0;
-                }
-                
-                if (bc & BCB_df && bc & BCR_df) {
-                    sol[n-1][m-1] = (2.0*sol[n-1][m-2]-sol[n-1][m-3] + 2.0*sol[n-2][m-1]-sol[n-3][m-1])/2.0;
-                }
-                
-                sum += std::abs(sol[i][j]);
-                sumOld += std::abs(solOld[i][j]);
-                solOld[i][j] = sol[i][j];
-            }
-            
-            sup[i-1] = sum;
-            supOld[i-1] = sumOld;
-            relErr = std::abs(sup.max_element()-supOld.max_element());
-        }
-        
-        ite++;
-        if (relErr < err) {
-            break;
-        }
-    }
+    const int ite = solveSYSTEM(false, "Laplace", bc, sbc, opt, x, y, sol, err, tol);
     
     if ((opt& ITERATIONS) != 0)
         std::cout << "\n [Información Laplace]: Se han realizado " << std::scientific << ite << " iteraciones.\n\n";
@@ -330,10 +301,9 @@ Matrix<EDP_T> EDP::solveLAPLACE_SBC(unsigned char sbc, Vector<EDP_T>& x, Vector<
 Matrix<EDP_T> EDP::solvePOISSON(unsigned char bc, unsigned char sbc, unsigned char opt, Vector<EDP_T>& x, Vector<EDP_T>& y, Matrix<EDP_T>& cI, EDP_T err, int tol)
 {
     int n = cI.rows(), m = cI.columns();
-    EDP_T hx = (EDP_T)(x[m-1]-x[0])/(m-1), hy = (EDP_T)(y[n-1]-y[0])/(n-1);
-    Matrix<EDP_T> sol(n,m), solOld(n,m);
+    Matrix<EDP_T> sol(n,m);
     
-    sol = solOld = cI;
+    sol = cI;
     
     //  Condiciones en los extremos superior e inferior (Condiciones en la función)
     for (int i=0; i<m; i++) {
@@ -355,90 +325,7 @@ Matrix<EDP_T> EDP::solvePOISSON(unsigned char bc, unsigned char sbc, unsigned ch
     }
     
     //  Solución de la ecuación de Poisson
-    int ite = 0;
-    EDP_T sum, sumOld, relErr;
-    Vector<EDP_T> sup(m-2), supOld(m-2);
-    
-    //  Solución de la ecuación - Condiciones de contorno normales
-    for (int k=0; k<tol; k++) {
-        for (int i=1; i<n-1; i++) {
-            sum = sumOld = 0.0;
-            for (int j=1; j<m-1; j++) {
-                //  Condiciones de contorno del borde izquierdo
-                if (bc & BCL_df) {
-                    sol[i][0] = (hx*hx*(sol[i+1][0] + sol[i-1][0]) + hy*hy*2*(sol[i][1] + hx*BCL(x[0],y[i])) - hy*hy*hx*hx*F(x[0],y[i]))/(2.0*(hy*hy+hx*hx));
-                }
-                
-                if (sbc & BCL_f) {
-                    sol[i][0] = SBCL(sol[i][1], sol[i-1][0], sol[i+1][0]);
-                }
-                
-                //  Condiciones de contorno del borde superior
-                if (bc & BCT_df) {
-                    sol[0][j] = (hx*hx*2*(sol[1][j] + hy*BCT(x[j],y[0])) + hy*hy*(sol[0][j+1] + sol[0][j-1]) - hy*hy*hx*hx*F(x[j],y[0]))/(2.0*(hy*hy+hx*hx));
-                }
-                
-                if (sbc & BCT_f) {
-                    sol[0][j] = SBCT(sol[0][j-1], sol[0][j+1], sol[1][j]);
-                }
-                
-                //  Condiciones de contorno del interior
-                if (sbc & BCI_f) {
-                    sol[i][j] = SBCI(sol[i][j-1], sol[i][j+1], sol[i-1][j], sol[i+1][j]);
-                } else {
-                    sol[i][j] = (hx*hx*(sol[i+1][j] + sol[i-1][j]) + hy*hy*(sol[i][j+1] + sol[i][j-1]) - hy*hy*hx*hx*F(x[j],y[i]))/(2.0*(hy*hy+hx*hx));
-                }
-                
-                //  Condiciones de contorno del borde inferior
-                if (bc & BCB_df) {
-                    sol[n-1][j] = (hx*hx*2*(sol[n-2][j] + hy*BCB(x[j],y[n-1])) + hy*hy*(sol[n-1][j+1] + sol[n-1][j-1]) - hy*hy*hx*hx*F(x[j],y[n-1]))/(2.0*(hy*hy+hx*hx));
-                }
-                
-                if (sbc & BCB_f) {
-                    sol[n-1][j] = SBCB(sol[n-1][j-1], sol[n-1][j+1], sol[n-2][j]);
-                }
-                
-                //  Condiciones de contorno del borde derecho
-                if (bc & BCR_df) {
-                    sol[i][m-1] = (hx*hx*(sol[i+1][m-1] + sol[i-1][m-1]) + hy*hy*2*(sol[i][m-2] + hx*BCR(x[m-1],y[i])) - hy*hy*hx*hx*F(x[m-1],y[i]))/(2.0*(hy*hy+hx*hx));
-                }
-                
-                if (sbc & BCR_f) {
-                    sol[i][m-1] = SBCR(sol[i][m-2], sol[i-1][m-1], sol[i+1][m-1]);
-                }
-                
-                //  Ajuste de las esquinas
-                if (bc & BCL_df && bc & BCT_df) {
-                    sol[0][0] = (2.0*sol[0][1]-sol[0][2] + 2.0*sol[1][0]-sol[2][0])/2.0;
-                }
-                
-                if (bc & BCT_df && bc & BCR_df) {
-                    sol[0][m-1] = (2.0*sol[0][m-2]-sol[0][m-3] + 2.0*sol[1][m-1]-sol[2][m-1])/2.0;
-                }
-                
-                if (bc & BCL_df && bc & BCB_df) {
-                    sol[n-1][0] = (2.0*sol[n-1][1]-sol[n-1][2] + 2.0*sol[n-2][0]-sol[n-3][0])/2.0;
-                }
-                
-                if (bc & BCB_df && bc & BCR_df) {
-                    sol[n-1][m-1] = (2.0*sol[n-1][m-2]-sol[n-1][m-3] + 2.0*sol[n-2][m-1]-sol[n-3][m-1])/2.0;
-                }
-                
-                sum += fabs(sol[i][j]);
-                sumOld += fabs(solOld[i][j]);
-                solOld[i][j] = sol[i][j];
-            }
-            
-            sup[i-1] = sum;
-            supOld[i-1] = sumOld;
-            relErr = std::abs(sup.max_element()-supOld.max_element());
-        }
-        
-        ite++;
-        if (relErr < err) {
-            break;
-        }
-    }
+    const int ite = solveSYSTEM(true, "Poisson", bc, sbc, opt, x, y, sol, err, tol);
     
     if ((opt& ITERATIONS) != 0)
         std::cout << "\n [Información Poisson]: Se han realizado " << std::scientific << ite << " iteraciones.\n\n";
@@ -491,7 +378,7 @@ Matrix<EDP_T> EDP::solvePOISSON_SBC(unsigned char sbc, Vector<EDP_T>& x, Vector<
 Vector<EDP_T> EDP::solveWAVE(unsigned char bc, unsigned char opt, Vector<EDP_T>& x, Vector<EDP_T>& cI, Vector<EDP_T>& cId)
 {
     int n = (int)x.size();
-    Vector<EDP_T> sol(n);
+    Vector<EDP_T> sol = pool1D.acquire(n);
     EDP_T dx = (EDP_T)abs((EDP_T)(x[n-1] - x[0])/(n-1));
     
     if (dt > dx/sqrt(Q1D(x[0]))) {
@@ -531,6 +418,7 @@ Vector<EDP_T> EDP::solveWAVE(unsigned char bc, unsigned char opt, Vector<EDP_T>&
         }
     }
     
+    pool1D.release(std::move(old1D));
     old1D = std::move(cI);
     time += dt;
     
@@ -545,186 +433,124 @@ Vector<EDP_T> EDP::solveWAVE(unsigned char bc, Vector<EDP_T>& x, Vector<EDP_T>&
 //  2 Dimensiones
 Matrix<EDP_T> EDP::solveWAVE(unsigned char bc, unsigned char opt, Vector<EDP_T> &x, Vector<EDP_T> &y, Matrix<EDP_T> &cI, Matrix<EDP_T> &cId, Matrix<bool> &fixed)
 {
-    int n = (int)y.size();
-    int m = (int)x.size();
-    Matrix<EDP_T> sol(n,m);
-    EDP_T dx = (EDP_T)abs((EDP_T)(x[m-1] - x[0])/(m-1));
-    EDP_T dy = (EDP_T)abs((EDP_T)(y[n-1] - y[0])/(n-1));
+    return solveWAVE(bc, opt, x, y, cI, cId, fixed, 1);
+}
+
+namespace {
     
-    if (dt > dx*dy/(sqrt(Q2D(x[0],y[0])*(dx*dx+dy*dy)))) {
-        dt = dx*dy/(sqrt(Q2D(x[0],y[0])*(dx*dx+dy*dy))) * 0.9;
-        std::cout << EDPwarning << "solveWAVE(bc, opt, x, cI, cId)] - El diferencial de tiempo era demasiado grande para obtener buenos resultados, se ha cambiado por: " << dt << std::endl;
+    //  cI es la solución devuelta en la llamada anterior (quizá modificada): vuelve al solver sin copiarse
+    void restoreWAVE(Matrix<EDP_T> &cI, Matrix<EDP_T> &current)
+    {
+        current.swap(cI);
     }
     
-    sol = cI;
+    //  En precisión simple se convierte sobre las mallas del solver
+    void restoreWAVE(Matrix<EDP_T> &cI, Matrix<float> &current)
+    {
+        std::copy(cI.begin(), cI.end(), current.begin());
+    }
     
-    if (!initEDP) {
+    template <typename Precision>
+    void restoreWAVE(Matrix<EDP_T> &cI, BasicWaveSolver2D<Precision> &solver)
+    {
+        restoreWAVE(cI, solver.current());
+    }
+    
+    //  Con varios procesos sólo vuelven a los rangos las filas que ha cambiado el llamador
+    template <typename Precision>
+    void restoreWAVE(Matrix<EDP_T> &cI, BasicDistributedWaveSolver2D<Precision> &solver)
+    {
+        solver.load(cI);
+    }
+    
+    Matrix<EDP_T> resultWAVE(Matrix<EDP_T> &current, Matrix<EDP_T> &)
+    {
+        return std::move(current);
+    }
+    
+    //  La solución en double se escribe sobre cI, que tiene las mismas dimensiones
+    Matrix<EDP_T> resultWAVE(Matrix<float> &current, Matrix<EDP_T> &cI)
+    {
+        std::copy(current.begin(), current.end(), cI.begin());
+        return std::move(cI);
+    }
+    
+    template <typename Precision>
+    Matrix<EDP_T> resultWAVE(BasicWaveSolver2D<Precision> &solver, Matrix<EDP_T> &cI)
+    {
+        return resultWAVE(solver.current(), cI);
+    }
+    
+    template <typename Precision>
+    Matrix<EDP_T> resultWAVE(BasicDistributedWaveSolver2D<Precision> &solver, Matrix<EDP_T> &cI)
+    {
+        solver.store(cI);
+        return std::move(cI);
+    }
+    
+}
+
+template <typename Solver>
+Matrix<EDP_T> EDP::stepWAVE(std::unique_ptr<Solver> &solver, unsigned char bc, unsigned char opt, Vector<EDP_T> &x, Vector<EDP_T> &y, Matrix<EDP_T> &cI, Matrix<EDP_T> &cId, Matrix<bool> &fixed, size_t steps)
+{
+    if (!initEDP || !solver || solver->rows() != cI.rows() || solver->columns() != cI.columns()) {
         initEDP = true;
         
-        old2D.zero();
-        if (bc & BCT_df) {  //  Condición en el borde superior de la membrana
-            for (int j=1; j<m-1; j++) {
-                if (!fixed[0][j]) {
-                    sol[0][j] = cI[0][j] + dt*cId[0][j] + Q2D(x[j],y[0])*dt*dt/2.0*((2.0*cI[1][j]-2.0*dy*BCT(x[j],y[0])-2.0*cI[0][j])/(dy*dy) + (cI[0][j+1]-2.0*cI[0][j]+cI[0][j-1])/(dx*dx));
-                }
-            }
-        }
-        
-        if (bc & BCL_df) {//  Condición en el borde izquierdo de la membrana
-            for (int i=1; i<n-1; i++) {
-                if (!fixed[i][0]) {
-                    sol[i][0] = cI[i][0] + dt*cId[i][0] + Q2D(x[0],y[i])*dt*dt/2.0*((cI[i+1][0]-2.0*cI[i][0]+cI[i-1][0])/(dy*dy) + (2.0*cI[i][1]-2.0*dx*BCL(x[0],y[i])-2.0*cI[i][0])/(dx*dx));
-                }
-            }
-        }
-        
-        //  Parallel
-        const size_t cores_number = std::thread::hardware_concurrency();
-        std::list<std::thread> workers;
-        
-        int start = 1;
-        int elements = (n-1) / cores_number;
-        int end = elements;
-        
-        for (int i = 0; i < cores_number; i++) {
-            if (i == cores_number-1) {
-                end += (n-1) % cores_number;
-            }
-            
-            workers.emplace_back([start, end, this, n, m, fixed, &sol, cI, cId, x, y, dx, dy]() {
-                for (int i=start; i<end; i++) {
-                    for (int j=1; j<m-1; j++) {
-                        if (!fixed[i][j]) {
-                            sol[i][j] = cI[i][j] + dt*cId[i][j] + Q2D(x[j],y[i])*dt*dt/2.0*((cI[i+1][j]-2.0*cI[i][j]+cI[i-1][j])/(dy*dy) + (cI[i][j+1]-2.0*cI[i][j]+cI[i][j-1])/(dx*dx));
-                        }
-                    }
-                }
-            });
-            
-            start = end;
-            end = start + elements;
-        }
-        
-        for (auto &&worker : workers) {
-            worker.join();
-        }
-        
-        if (bc & BCR_df) {  //  Condición en el borde derecho de la membrana
-            for (int i=1; i<n-1; i++) {
-                if (!fixed[i][m-1]) {
-                    sol[i][m-1] = cI[i][m-1] + dt*cId[i][m-1] + Q2D(x[m-1],y[i])*dt*dt/2.0*((cI[i+1][m-1]-2.0*cI[i][m-1]+cI[i-1][m-1])/(dy*dy) + (2.0*cI[i][m-2]+2.0*dx*BCR(x[m-1],y[i])-2.0*cI[i][m-1])/(dx*dx));
-                }
-            }
-        }
-        
-        if (bc & BCB_df) {  //  Condición en el borde inferior de la membrana
-            for (int j=1; j<m-1; j++) {
-                if (!fixed[n-1][j]) {
-                    sol[n-1][j] = cI[n-1][j] + dt*cId[n-1][j] + Q2D(x[j],y[n-1])*dt*dt/2.0*((2.0*cI[n-2][j]+2.0*dy*BCB(x[j],y[n-1])-2.0*cI[n-1][j])/(dy*dy) + (cI[n-1][j+1]-2.0*cI[n-1][j]+cI[n-1][j-1])/(dx*dx));
-                }
-            }
-        }
-        
-        if (bc & BCL_df && bc & BCT_df && !fixed[0][0]) {
-            sol[0][0] = cI[0][0] + dt*cId[0][0] + Q2D(x[0],y[0])*dt*dt*((cI[1][0]-cI[0][0]-dy*BCT(x[0],y[0]))/(dy*dy) + (cI[0][1]-cI[0][0]-dx*BCL(x[0],y[0]))/(dx*dx));
-        }
-                
-        if (bc & BCT_df && bc & BCR_df && !fixed[0][m-1]) {
-            sol[0][m-1] = cI[0][m-1] + dt*cId[0][m-1] + Q2D(x[m-1],y[0])*dt*dt*((cI[1][m-1]-cI[0][m-1]-dy*BCT(x[m-1],y[0]))/(dy*dy) + (cI[0][m-2]-cI[0][m-1]+dx*BCR(x[m-1],y[0]))/(dx*dx));
-        }
-        
-        if (bc & BCL_df && bc & BCB_df && !fixed[n-1][0]) {
-            sol[n-1][0] = cI[n-1][0] + dt*cId[n-1][0] + Q2D(x[0],y[n-1])*dt*dt*((cI[n-2][0]-cI[n-1][0]+dy*BCB(x[0],y[n-1]))/(dy*dy) + (cI[n-1][1]-cI[n-1][0]-dx*BCL(x[0],y[n-1]))/(dx*dx));
+        solver.reset(new Solver(*this, bc, x, y, cI, cId, fixed));
+        if (solver->dt() != dt) {
+            dt = solver->dt();
+            std::cout << EDPwarning << "solveWAVE(bc, opt, x, cI, cId)] - El diferencial de tiempo era demasiado grande para obtener buenos resultados, se ha cambiado por: " << dt << std::endl;
         }
-        
-        if (bc & BCB_df && bc & BCR_df && !fixed[n-1][m-1]) {
-            sol[n-1][m-1] = cI[n-1][m-1] + dt*cId[n-1][m-1] + Q2D(x[m-1],y[n-1])*dt*dt*((cI[n-2][m-1]-cI[n-1][m-1]+dy*BCB(x[m-1],y[n-1]))/(dy*dy) + (cI[n-1][m-2]-cI[n-1][m-1]+dx*BCR(x[m-1],y[n-1]))/(dx*dx));
-        }
-        
     } else {
-        if (bc & BCT_df) {  //  Condición en el borde superior de la membrana
-            for (int j=1; j<m-1; j++) {
-                if (!fixed[0][j]) {
-                    sol[0][j] = 2.0*cI[0][j] + dt*dt*Q2D(x[j],y[0])*((2.0*cI[1][j]-2.0*dy*BCT(x[j],y[0])-2.0*cI[0][j])/(dy*dy) + (cI[0][j+1]-2.0*cI[0][j]+cI[0][j-1])/(dx*dx)) - old2D[0][j];
-                }
-            }
-        }
-        
-        if (bc & BCL_df) {  //  Condición en el borde izquierdo de la membrana
-            for (int i=1; i<n-1; i++) {
-                if (!fixed[i][0]) {
-                    sol[i][0] = 2.0*cI[i][0] + dt*dt*Q2D(x[0],y[i])*((cI[i+1][0]-2.0*cI[i][0]+cI[i-1][0])/(dy*dy) + (2.0*cI[i][1]-2.0*dx*BCL(x[0],y[i])-2.0*cI[i][0])/(dx*dx)) - old2D[i][0];
-                }
-            }
-        }
+        restoreWAVE(cI, *solver);
+        //  Q2D y las condiciones pueden leer variables que cambian entre llamadas (CACHE_COEFFICIENTS las conserva)
+        solver->setCoefficients(*this, opt & CACHE_COEFFICIENTS);
         
-        //  Parallel
-        size_t cores_number = std::thread::hardware_concurrency();
-        std::list<std::thread> workers;
-
-        int start = 1;
-        int elements = (n-1) / cores_number;
-        int end = elements;
-
-        for (int i = 0; i < cores_number; i++) {
-            if (i == cores_number-1) {
-                end += (n-1) % cores_number;
-            }
-
-            workers.emplace_back([start, end, this, &n, &m, &fixed, &sol, &cI, &cId, &x, &y, &dx, &dy]() {
-                for (int i=start; i<end; i++) {
-                    for (int j=1; j<m-1; j++) {
-                        if (!fixed[i][j]) {
-                            sol[i][j] = 2.0*cI[i][j] + dt*dt*Q2D(x[j],y[i])*((cI[i+1][j]-2.0*cI[i][j]+cI[i-1][j])/(dy*dy) + (cI[i][j+1]-2.0*cI[i][j]+cI[i][j-1])/(dx*dx)) - old2D[i][j];
-                        }
-                    }
-                }
-            });
-
-            start = end;
-            end = start + elements;
-        }
+        //  La máscara puede cambiar entre llamadas
+        solver->setFixed(fixed);
+    }
+    
+    solver->step(steps);
+    
+    return resultWAVE(*solver, cI);
+}
 
-        for (auto &&worker : workers) {
-            worker.join();
-        }
-        
-        if (bc & BCR_df) {  //  Condición en el borde derecho de la membrana
-            for (int i=1; i<n-1; i++) {
-                if (!fixed[i][m-1]) {
-                    sol[i][m-1] = 2.0*cI[i][m-1] + dt*dt*Q2D(x[m-1],y[i])*((cI[i+1][m-1]-2.0*cI[i][m-1]+cI[i-1][m-1])/(dy*dy) + (2.0*cI[i][m-2]+2.0*dx*BCR(x[m-1],y[i])-2.0*cI[i][m-1])/(dx*dx)) - old2D[i][m-1];
-                }
-            }
-        }
-        
-        if (bc & BCB_df) {  //  Condición en el borde inferior de la membrana
-            for (int j=1; j<m-1; j++) {
-                if (!fixed[n-1][j]) {
-                    sol[n-1][j] = 2.0*cI[n-1][j] + dt*dt*Q2D(x[j],y[n-1])*((2.0*cI[n-2][j]+2.0*dy*BCB(x[j],y[n-1])-2.0*cI[n-1][j])/(dy*dy) + (cI[n-1][j+1]-2.0*cI[n-1][j]+cI[n-1][j-1])/(dx*dx)) - old2D[n-1][j];
-                }
-            }
-        }
-        
-        if (bc & BCL_df && bc & BCT_df && !fixed[0][0]) {
-            sol[0][0] = 2.0*(cI[0][0] + dt*dt*Q2D(x[0],y[0])*((cI[1][0]-cI[0][0]-dy*BCT(x[0],y[0]))/(dy*dy) + (cI[0][1]-cI[0][0]-dx*BCL(x[0],y[0]))/(dx*dx))) - old2D[0][0];
-        }
-        
-        if (bc & BCT_df && bc & BCR_df && !fixed[0][m-1]) {
-            sol[0][m-1] = 2.0*(cI[0][m-1] + dt*dt*Q2D(x[m-1],y[0])*((cI[1][m-1]-cI[0][m-1]-dy*BCT(x[m-1],y[0]))/(dy*dy) + (cI[0][m-2]-cI[0][m-1]+dx*BCR(x[m-1],y[0]))/(dx*dx))) - old2D[0][m-1];
-        }
-        
-        if (bc & BCL_df && bc & BCB_df && !fixed[n-1][0]) {
-            sol[n-1][0] = 2.0*(cI[n-1][0] + dt*dt*Q2D(x[0],y[n-1])*((cI[n-2][0]-cI[n-1][0]+dy*BCB(x[0],y[n-1]))/(dy*dy) + (cI[n-1][1]-cI[n-1][0]-dx*BCL(x[0],y[n-1]))/(dx*dx))) - old2D[n-1][0];
-            
-        }
-        
-        if (bc & BCB_df && bc & BCR_df && !fixed[n-1][m-1]) {
-            sol[n-1][m-1] = 2.0*(cI[n-1][m-1] + dt*dt*Q2D(x[m-1],y[n-1])*((cI[n-2][m-1]-cI[n-1][m-1]+dy*BCB(x[m-1],y[n-1]))/(dy*dy) + (cI[n-1][m-2]-cI[n-1][m-1]+dx*BCR(x[m-1],y[n-1]))/(dx*dx))) - old2D[n-1][m-1];
-        }
+Matrix<EDP_T> EDP::solveWAVE(unsigned char bc, unsigned char opt, Vector<EDP_T> &x, Vector<EDP_T> &y, Matrix<EDP_T> &cI, Matrix<EDP_T> &cId, Matrix<bool> &fixed, size_t steps)
+{
+    //  Al cambiar de precisión o de número de procesos se empieza de nuevo a partir de cI
+    if (processes <= 1 || !(opt & SINGLE_PRECISION)) {
+        wave2DDistributedSingle.reset();
+    }
+    if (processes <= 1 || opt & SINGLE_PRECISION) {
+        wave2DDistributed.reset();
+    }
+    if (wave2DDistributed && wave2DDistributed->processes() != processes) {
+        wave2DDistributed.reset();
+    }
+    if (wave2DDistributedSingle && wave2DDistributedSingle->processes() != processes) {
+        wave2DDistributedSingle.reset();
+    }
+    if (processes > 1 || !(opt & SINGLE_PRECISION)) {
+        wave2DSingle.reset();
+    }
+    if (processes > 1 || opt & SINGLE_PRECISION) {
+        wave2D.reset();
+    }
+    
+    Matrix<EDP_T> sol;
+    if (processes > 1 && opt & SINGLE_PRECISION) {
+        sol = stepWAVE(wave2DDistributedSingle, bc, opt, x, y, cI, cId, fixed, steps);
+    } else if (processes > 1) {
+        sol = stepWAVE(wave2DDistributed, bc, opt, x, y, cI, cId, fixed, steps);
+    } else if (opt & SINGLE_PRECISION) {
+        sol = stepWAVE(wave2DSingle, bc, opt, x, y, cI, cId, fixed, steps);
+    } else {
+        sol = stepWAVE(wave2D, bc, opt, x, y, cI, cId, fixed, steps);
     }
     
-    old2D = std::move(cI);
-    time += (EDP_T)dt;
+    for (size_t s = 0; s < steps; ++s) {
+        time += (EDP_T)dt;
+    }
     
     if (opt & SAVE_DATA) {
         if (pathEDP != "") {
@@ -737,6 +563,24 @@ Matrix<EDP_T> EDP::solveWAVE(unsigned char bc, unsigned char opt, Vector<EDP_T>
     return sol;
 }
 
+Matrix<EDP_T> EDP::advance(unsigned char bc, unsigned char opt, Vector<EDP_T> &x, Vector<EDP_T> &y, Matrix<EDP_T> &cI, Matrix<EDP_T> &cId, Matrix<bool> &fixed, size_t steps, size_t every, const std::function<void(Matrix<EDP_T> &sol)> &frame)
+{
+    every = std::max<size_t>(every, 1);
+    
+    //  La solución vuelve al solver en cada tanda sin copiarse
+    for (size_t done = 0; done < steps; ) {
+        const size_t batch = std::min(every, steps - done);
+        cI = solveWAVE(bc, opt, x, y, cI, cId, fixed, batch);
+        done += batch;
+        
+        if (frame) {
+            frame(cI);
+        }
+    }
+    
+    return std::move(cI);
+}
+
 Matrix<EDP_T> EDP::solveWave(unsigned char bc, Vector<EDP_T> &x, Vector<EDP_T> &y, Matrix<EDP_T> &cI, Matrix<EDP_T> &cId, Matrix<bool> &fixed)
 {
     return solveWAVE(bc, 0, x, y, cI, cId, fixed);
@@ -905,9 +749,33 @@ Matrix<EDP_T> EDP::solveHEAT(unsigned char bc, unsigned char opt, Vector<EDP_T>&
         }
     }
     
-    for (int i=1; i<n-1; i++) {
-        for (int j=1; j<m-1; j++) {
-            sol[i][j] = cI[i][j] + dt*Q2D(x[j],y[i])*((cI[i+1][j]-2.0*cI[i][j]+cI[i-1][j])/(dy*dy) + (cI[i][j+1]-2.0*cI[i][j]+cI[i][j-1])/(dx*dx));
+    if (opt & CACHE_COEFFICIENTS) {
+        //  Q2D se evalúa sólo cuando cambian la función o la malla
+        if (!heatQ2D.samples(Q2D, x, y)) {
+            heatQ2D.sample(Q2D, x, y);
+        }
+        
+        for (int i=1; i<n-1; i++) {
+            const EDP_T *up = cI[i-1], *c = cI[i], *down = cI[i+1];
+            EDP_T *s = sol[i];
+            
+            if (heatQ2D.is_uniform()) {
+                const EDP_T q = heatQ2D.value();
+                for (int j=1; j<m-1; j++) {
+                    s[j] = c[j] + dt*q*((down[j]-2.0*c[j]+up[j])/(dy*dy) + (c[j+1]-2.0*c[j]+c[j-1])/(dx*dx));
+                }
+            } else {
+                const EDP_T *q = heatQ2D[i];
+                for (int j=1; j<m-1; j++) {
+                    s[j] = c[j] + dt*q[j]*((down[j]-2.0*c[j]+up[j])/(dy*dy) + (c[j+1]-2.0*c[j]+c[j-1])/(dx*dx));
+                }
+            }
+        }
+    } else {
+        for (int i=1; i<n-1; i++) {
+            for (int j=1; j<m-1; j++) {
+                sol[i][j] = cI[i][j] + dt*Q2D(x[j],y[i])*((cI[i+1][j]-2.0*cI[i][j]+cI[i-1][j])/(dy*dy) + (cI[i][j+1]-2.0*cI[i][j]+cI[i][j-1])/(dx*dx));
+            }
         }
     }
     
@@ -952,6 +820,116 @@ Matrix<EDP_T> EDP::solveHEAT(unsigned char bc, unsigned char opt, Vector<EDP_T>&
     return sol;
 }
 
+Matrix<EDP_T> EDP::solveHEAT(unsigned char bc, unsigned char opt, Vector<EDP_T>& x, Vector<EDP_T>& y, Matrix<EDP_T>& cI, size_t steps)
+{
+    const size_t n = y.size();
+    const size_t m = x.size();
+    const EDP_T dx = (EDP_T)abs((EDP_T)(x[m-1] - x[0])/(m-1));
+    const EDP_T dy = (EDP_T)abs((EDP_T)(y[n-1] - y[0])/(n-1));
+    
+    if (dt > dx*dx*dy*dy/(dx*dx+dy*dy)*1/(4*Q2D(x[0],y[0]))) {
+        dt = dx*dx*dy*dy/(dx*dx+dy*dy)*1/(4*Q2D(x[0],y[0])) * 0.9;
+        std::cout << " El diferencial de tiempo era demasiado grande para obtener buenos resultados, se ha cambiado por: " << dt << std::endl;
+    }
+    
+    if (!heatQ2D.samples(Q2D, x, y)) {
+        heatQ2D.sample(Q2D, x, y);
+    }
+    
+    //  El paso s lee grid[s%2] y escribe grid[(s+1)%2]. Cada hilo copia primero las filas que luego calcula
+    const size_t members = std::max<size_t>(1, n*m / CDA_TEAM_GRAIN);
+    Matrix<EDP_T> grid[] = {Matrix<EDP_T>(n, m), Matrix<EDP_T>(n, m)};
+    blocking::touch(n, members, [&](const size_t &lo, const size_t &hi) {
+        std::copy(cI[lo], cI[hi - 1] + m, grid[0][lo]);
+        std::copy(cI[lo], cI[hi - 1] + m, grid[1][lo]);
+    });
+    
+    //  Fila i del paso s. Las mismas expresiones y en el mismo orden que la versión de un paso
+    const auto row = [&](const size_t &s, const size_t &i) {
+        const Matrix<EDP_T> &c = grid[s % 2];
+        Matrix<EDP_T> &sol = grid[(s+1) % 2];
+        
+        std::copy(c[i], c[i] + m, sol[i]);
+        
+        if (i == 0) {
+            if (bc & BCT_df) {  //  Condición en el borde superior de la membrana
+                for (size_t j=1; j<m-1; j++) {
+                    sol[0][j] = c[0][j] + dt*heatQ2D(0,j)*((2.0*c[1][j]-2.0*dy*BCT(x[j],y[0])-2.0*c[0][j])/(dy*dy) + (c[0][j+1]-2.0*c[0][j]+c[0][j-1])/(dx*dx));
+                }
+            }
+        } else if (i == n-1) {
+            if (bc & BCB_df) {  //  Condición en el borde inferior de la membrana
+                for (size_t j=1; j<m-1; j++) {
+                    sol[n-1][j] = c[n-1][j] + dt*heatQ2D(n-1,j)*((2.0*c[n-2][j]+2.0*dy*BCB(x[j],y[n-1])-2.0*c[n-1][j])/(dy*dy) + (c[n-1][j+1]-2.0*c[n-1][j]+c[n-1][j-1])/(dx*dx));
+                }
+            }
+        } else {
+            if (bc & BCL_df) {  //  Condición en el borde izquierdo de la membrana
+                sol[i][0] = c[i][0] + dt*heatQ2D(i,0)*((c[i+1][0]-2.0*c[i][0]+c[i-1][0])/(dy*dy) + (2.0*c[i][1]-2.0*dx*BCL(x[0],y[i])-2.0*c[i][0])/(dx*dx));
+            }
+            
+            const EDP_T *up = c[i-1], *ci = c[i], *down = c[i+1];
+            EDP_T *s = sol[i];
+            
+            if (heatQ2D.is_uniform()) {
+                const EDP_T q = heatQ2D.value();
+                for (size_t j=1; j<m-1; j++) {
+                    s[j] = ci[j] + dt*q*((down[j]-2.0*ci[j]+up[j])/(dy*dy) + (ci[j+1]-2.0*ci[j]+ci[j-1])/(dx*dx));
+                }
+            } else {
+                const EDP_T *q = heatQ2D[i];
+                for (size_t j=1; j<m-1; j++) {
+                    s[j] = ci[j] + dt*q[j]*((down[j]-2.0*ci[j]+up[j])/(dy*dy) + (ci[j+1]-2.0*ci[j]+ci[j-1])/(dx*dx));
+                }
+            }
+            
+            if (bc & BCR_df) {  //  Condición en el borde derecho de la membrana
+                sol[i][m-1] = c[i][m-1] + dt*heatQ2D(i,m-1)*((c[i+1][m-1]-2.0*c[i][m-1]+c[i-1][m-1])/(dy*dy) + (2.0*c[i][m-2]+2.0*dx*BCR(x[m-1],y[i])-2.0*c[i][m-1])/(dx*dx));
+            }
+        }
+        
+        //  Esquinas: usan los valores nuevos de las tres primeras o las tres últimas filas
+        if (i == 2) {
+            if (bc & BCL_df && bc & BCT_df) {
+                sol[0][0] = (2.0*sol[0][1]-sol[0][2] + 2.0*sol[1][0]-sol[2][0])/2.0;
+            }
+            
+            if (bc & BCT_df && bc & BCR_df) {
+                sol[0][m-1] = (2.0*sol[0][m-2]-sol[0][m-3] + 2.0*sol[1][m-1]-sol[2][m-1])/2.0;
+            }
+        }
+        
+        if (i == n-1) {
+            if (bc & BCL_df && bc & BCB_df) {
+                sol[n-1][0] = (2.0*sol[n-1][1]-sol[n-1][2] + 2.0*sol[n-2][0]-sol[n-3][0])/2.0;
+            }
+            
+            if (bc & BCB_df && bc & BCR_df) {
+                sol[n-1][m-1] = (2.0*sol[n-1][m-2]-sol[n-1][m-3] + 2.0*sol[n-2][m-1]-sol[n-3][m-1])/2.0;
+            }
+        }
+    };
+    
+    //  Las esquinas de arriba se calculan en la fila 2: el frente necesita dos filas de retraso por paso
+    blocking::advance(n, steps, 3 * m * sizeof(EDP_T), members, 2, row);
+    
+    for (size_t s = 0; s < steps; ++s) {
+        time += dt;
+    }
+    
+    Matrix<EDP_T> sol(std::move(grid[steps % 2]));
+    
+    if (opt & SAVE_DATA) {
+        if (pathEDP != "") {
+            saveDATA(pathEDP, "HEATEquation.csv", x, y, sol);
+        } else {
+            saveDATA("HEATEquation.csv", DESKTOP, x, y, sol);
+        }
+    }
+    
+    return sol;
+}
+
 Matrix<EDP_T> EDP::solveHEAT(unsigned char bc, Vector<EDP_T>& x, Vector<EDP_T>& y, Matrix<EDP_T>& cI)
 {
     return solveHEAT(bc, 0, x, y, cI);
@@ -30,18 +30,38 @@
                                 //  y un .m con las instrucciones para pintar en MATLAB
 #define DESKTOP         0x10
 #define DOCUMENTS       0x20
+#define CACHE_COEFFICIENTS  0x80    //  Muestrea Q2D una sola vez en la malla en lugar de llamarla en cada paso. En solveWAVE
+                                    //  (2D) conserva además Q2D y los bordes muestreados entre llamadas mientras no cambien
+                                    //  las funciones: no usar si dependen de variables que cambian
+#define SINGLE_PRECISION    0x40    //  solveWAVE en 2D: guarda y calcula el estado en float. Suficiente para visualizar
 
 //  Para el método de integración de diferencias finitas
 #define LUmethod        0x20
 #define GSmethod        0x40
 
+//  Para el método de resolución de Laplace y Poisson: valores de EDP::method, no bits de opt.
+//  Con 0 (GSmethod2D) se usa Gauss-Seidel
+#define GSmethod2D      0x00
+#define SORmethod       0x01    //  Sobrerrelajación rojo-negro en paralelo (PoissonSolver2D)
+#define MGmethod        0x02    //  Multigrid geométrico con ciclos V (PoissonSolver2D). err es el residuo
+#define FFTmethod       0x03    //  Solución directa con transformadas de senos y cosenos (PoissonSolver2D::fourier)
+#define CGmethod        0x04    //  Gradiente conjugado sin matriz (PoissonSolver2D). Sólo bordes fijos. err es el residuo
+#define PCGJmethod      0x05    //  Gradiente conjugado precondicionado con la diagonal
+#define PCGSSORmethod   0x06    //  Gradiente conjugado precondicionado con SSOR rojo-negro (omega)
+#define PCGICmethod     0x07    //  Gradiente conjugado precondicionado con Cholesky incompleto IC(0)
+
 
 #include <iostream>
 #include <iomanip>
 #include <cmath>
 #include <fstream>
+#include <functional>
+#include <memory>
 
 #include "../containers.hpp"
+#include "../memory/pool.hpp"
+#include "Precision.h"
+#include "CoefficientField.h"
 
 
 namespace cda {
@@ -50,16 +70,53 @@ namespace cda {
 
             typedef double EDP_T;
             
+            template <typename Precision>
+            class BasicWaveSolver2D;
+            
+            template <typename Precision>
+            class BasicDistributedWaveSolver2D;
+            
             class EDP {
             private:
                 
                 //  ECUACIÓN DE ONDAS
                 //  Para almacenar la situación anterior.
                 containers::Vector<EDP_T> old1D;
-                containers::Matrix<EDP_T> old2D;
                 containers::Matrix<bool> fixedEDP;
                 
+                //  Buffers reutilizados entre pasos de tiempo: el bucle temporal no reserva memoria
+                //  una vez se han creado los primeros.
+                memory::Pool<containers::Vector<EDP_T>> pool1D;
+                
+                //  En 2 dimensiones el estado (anterior, actual y siguiente) vive en el solver.
+                //  Sólo uno existe a la vez, según la opción SINGLE_PRECISION y el número de procesos.
+                std::unique_ptr<BasicWaveSolver2D<DoublePrecision>> wave2D;
+                std::unique_ptr<BasicWaveSolver2D<SinglePrecision>> wave2DSingle;
+                std::unique_ptr<BasicDistributedWaveSolver2D<DoublePrecision>> wave2DDistributed;
+                std::unique_ptr<BasicDistributedWaveSolver2D<SinglePrecision>> wave2DDistributedSingle;
+                
+                //  Avanza steps pasos con solver, creándolo si hace falta
+                template <typename Solver>
+                containers::Matrix<EDP_T> stepWAVE(std::unique_ptr<Solver> &solver, unsigned char bc, unsigned char opt,
+                                                   containers::Vector<EDP_T> &x, containers::Vector<EDP_T> &y,
+                                                   containers::Matrix<EDP_T> &cI, containers::Matrix<EDP_T> &cId,
+                                                   containers::Matrix<bool> &fixed, size_t steps);
+                
+                //  ECUACIÓN DEL CALOR
+                //  Q2D muestreada en la malla (opción CACHE_COEFFICIENTS)
+                CoefficientField heatQ2D;
+                
+                //  ECUACIONES DE LAPLACE Y POISSON
+                //  Resuelve con el método de EDP::method sobre sol, con los bordes ya fijados, y devuelve el número
+                //  de iteraciones. label ("Laplace" o "Poisson") encabeza los mensajes
+                int solveSYSTEM(bool poisson, const char *label, unsigned char bc, unsigned char sbc, unsigned char opt,
+                                containers::Vector<EDP_T> &x, containers::Vector<EDP_T> &y,
+                                containers::Matrix<EDP_T> &sol, EDP_T err, int tol);
+                
             public:
+                EDP();
+                ~EDP();
+                
                 //  --- RUTA PARA GUARDAR DATOS ---
                 std::string pathEDP;
                 
@@ -119,6 +176,17 @@ namespace cda {
                                                            containers::Vector<EDP_T>& x, containers::Vector<EDP_T>& y,
                                                            containers::Matrix<EDP_T>& cI, EDP_T err);
                 
+                //  Método de resolución de solveLAPLACE y solvePOISSON (GSmethod2D, SORmethod, MGmethod, FFTmethod,
+                //  CGmethod, PCGJmethod, PCGSSORmethod o PCGICmethod)
+                unsigned char method = GSmethod2D;
+                
+                //  Factor de relajación de SORmethod y del precondicionador de PCGSSORmethod. Con 0 se estima el
+                //  óptimo para SOR en la malla y se usa 1 (Gauss-Seidel simétrico) para SSOR
+                EDP_T omega = 0;
+                
+                //  Cada cuántas iteraciones comprueba Gauss-Seidel la convergencia. Con 1, en todas
+                size_t checkStride = 1;
+                
                 //  POISSON
                 //  CONDICIÓN DE LA EC. DE POISSON
                 //  Es importante que esta función no dependa de otros puntos de la matriz.
@@ -163,6 +231,19 @@ namespace cda {
                 EDP_T (* Q1D)(EDP_T x);  //  Constante o función Q() que acompaña al laplaciano en 1 dimensión.
                 EDP_T (* Q2D)(EDP_T x, EDP_T y);
                 
+                //  Procesos entre los que se reparte la malla de solveWAVE en 2 dimensiones (DistributedWaveSolver2D).
+                //  Con 1 no se reparte
+                size_t processes = 1;
+                
+                //  Si este proceso es uno de los rangos de DistributedWaveSolver2D, atiende al coordinador y termina
+                //  sin volver. Con processes > 1 hay que llamarla al principio de main()
+                static void runRankIfRequested();
+                
+                //  Número de soluciones que han tenido que reservarse en memoria
+                size_t allocationsWAVE() const {
+                    return pool1D.allocations();
+                }
+                
                 //  FUNCIONES DE LA EC. DE ONDA
                 containers::Vector<EDP_T> solveWAVE(unsigned char bc, unsigned char opt,
                                                     containers::Vector<EDP_T>& x, containers::Vector<EDP_T>& cI,
@@ -177,6 +258,21 @@ namespace cda {
                                                     containers::Matrix<EDP_T> &cI, containers::Matrix<EDP_T> &cId,
                                                     containers::Matrix<bool> &fixed);
                 
+                //  Avanza steps pasos de una vez, con bloqueo temporal. Mismo resultado que steps llamadas
+                containers::Matrix<EDP_T> solveWAVE(unsigned char bc, unsigned char opt,
+                                                    containers::Vector<EDP_T> &x, containers::Vector<EDP_T> &y,
+                                                    containers::Matrix<EDP_T> &cI, containers::Matrix<EDP_T> &cId,
+                                                    containers::Matrix<bool> &fixed, size_t steps);
+                
+                //  Avanza steps pasos en tandas de every pasos, cada una con bloqueo temporal, y llama a frame(sol)
+                //  al final de cada tanda (p. ej. para pintarla). frame puede modificar sol antes de la tanda siguiente,
+                //  como cI entre llamadas a solveWAVE. Mismo resultado que steps llamadas
+                containers::Matrix<EDP_T> advance(unsigned char bc, unsigned char opt,
+                                                  containers::Vector<EDP_T> &x, containers::Vector<EDP_T> &y,
+                                                  containers::Matrix<EDP_T> &cI, containers::Matrix<EDP_T> &cId,
+                                                  containers::Matrix<bool> &fixed, size_t steps, size_t every,
+                                                  const std::function<void(containers::Matrix<EDP_T> &sol)> &frame);
+                
                 containers::Matrix<EDP_T> solveWave(unsigned char bc,
                                                     containers::Vector<EDP_T> &x, containers::Vector<EDP_T> &y,
                                                     containers::Matrix<EDP_T> &cI, containers::Matrix<EDP_T> &cId,
@@ -198,6 +294,12 @@ namespace cda {
                 containers::Matrix<EDP_T> solveHEAT(unsigned char bc,
                                                     containers::Vector<EDP_T>& x, containers::Vector<EDP_T>& y, containers::Matrix<EDP_T>& cI);
                 
+                //  Avanza steps pasos de una vez, con bloqueo temporal y Q2D muestreada (CACHE_COEFFICIENTS).
+                //  Mismo resultado que steps llamadas
+                containers::Matrix<EDP_T> solveHEAT(unsigned char bc, unsigned char opt,
+                                                    containers::Vector<EDP_T>& x, containers::Vector<EDP_T>& y, containers::Matrix<EDP_T>& cI,
+                                                    size_t steps);
+                
                 //  -- ECUACIONES DEL TIPO -> ∂²u/∂t² = -k²u --
                 //  Calcula los autovalores y autovectores de dicha ecuación.
                 containers::Vector<EDP_T> eigenVAL_VEC(containers::Vector<EDP_T>& x,
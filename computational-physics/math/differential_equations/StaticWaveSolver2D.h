@@ -0,0 +1,78 @@
+//
+//  StaticWaveSolver2D.h
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <type_traits>
+
+#include "WaveGrid2D.h"
+
+
+namespace cda {
+    namespace math {
+        namespace differential_equations {
+
+            //  -- ECUACIÓN DE ONDAS EN 2 DIMENSIONES CON NÚCLEO ESPECÍFICO --
+            //  Mismo esquema que WaveSolver2D, pero las condiciones de contorno y los funtores Q(x,y) y
+            //  BCx(x,y) son parámetros de plantilla: cada combinación genera su propio núcleo, los bordes
+            //  sin condición en la derivada desaparecen al compilar y Q se expande en línea en el bucle interior.
+            //
+            //  Ejemplo: membrana con los bordes izquierdo y derecho libres y velocidad constante
+            //      StaticWaveSolver2D<BCL_df | BCR_df, wave::Constant> solver(wave::Constant{1.0}, x, y, cI, cId, fixed, dt);
+            //
+            //  Los funtores reciben (x, y) y devuelven EDP_T. Deben poder llamarse desde varios hilos a la vez.
+            //  Precision (Precision.h) elige el tipo de las mallas y de las operaciones, como en BasicWaveSolver2D.
+            template <unsigned char BC, typename Coefficient,
+                      typename Left = wave::Zero, typename Right = wave::Zero,
+                      typename Top = wave::Zero, typename Bottom = wave::Zero,
+                      typename Precision = DoublePrecision>
+            class StaticWaveSolver2D : public WaveGrid2D<Precision> {
+            public:
+
+                /**
+                 @param Q Coeficiente Q(x,y)
+                 @param x Coordenadas de las columnas
+                 @param y Coordenadas de las filas
+                 @param cI Condición inicial
+                 @param cId Derivada temporal inicial
+                 @param fixed Puntos que no evolucionan
+                 @param dt Paso de tiempo. Se reduce si no cumple la condición CFL
+                 @param time Instante inicial
+                 */
+                StaticWaveSolver2D(const Coefficient &Q,
+                                   const containers::Vector<EDP_T> &x, const containers::Vector<EDP_T> &y,
+                                   const containers::Matrix<EDP_T> &cI, const containers::Matrix<EDP_T> &cId,
+                                   const containers::Matrix<bool> &fixed, EDP_T dt, EDP_T time = 0,
+                                   const Left &BCL = Left(), const Right &BCR = Right(),
+                                   const Top &BCT = Top(), const Bottom &BCB = Bottom()) :
+                WaveGrid2D<Precision>(time, dt, x, y, cI, cId, fixed), Q(Q), BCL(BCL), BCR(BCR), BCT(BCT), BCB(BCB)
+                {
+                    this->limitTimeStep(Q(x[0], y[0]));
+                }
+
+                /**
+                 Avanza \p steps pasos de tiempo
+                 */
+                void step(size_t steps = 1) {
+                    const containers::Vector<EDP_T> &x = this->x, &y = this->y;
+                    const wave::EvaluatedBoundaries<Left, Right, Top, Bottom> boundaries = {BCL, BCR, BCT, BCB, x, y};
+                    this->advance(steps, wave::Evaluated<Coefficient>{Q, x, y}, std::integral_constant<unsigned char, BC>(), boundaries);
+                }
+
+            private:
+
+                Coefficient Q;
+                Left BCL;
+                Right BCR;
+                Top BCT;
+                Bottom BCB;
+            };
+
+        } /* namespace differential_equations */
+    } /* namespace math */
+} /* namespace cda */
@@ -0,0 +1,238 @@
+//
+//  TemporalBlocking.h
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "../parallel/team.hpp"
+
+
+//  Memoria que puede ocupar el frente de onda de un hilo (filas en vuelo de todas las mallas)
+#define CDA_BLOCKING_CACHE (1024 * 1024)
+
+//  Máximo número de pasos por bloque
+#define CDA_BLOCKING_STEPS 8
+
+
+namespace cda {
+    namespace math {
+        namespace differential_equations {
+            namespace blocking {
+
+                //  -- BLOQUEO TEMPORAL DE ESQUEMAS EXPLÍCITOS POR FILAS --
+                //  Para esquemas en los que la fila i del paso s+1 sólo depende de las filas i-1, i, i+1
+                //  de los pasos anteriores.
+                //
+                //  Cada hilo avanza varios pasos seguidos sobre su banda de filas con un frente de onda:
+                //  en la posición p calcula la fila p del primer paso, la p-1 del segundo, la p-2 del tercero...
+                //  Así las filas que lee un paso las acaba de escribir el anterior y siguen en la caché.
+                //
+                //  Dentro de la banda el frente se estrecha una fila por paso en cada lado con vecino
+                //  (trapecio), porque las filas del borde necesitan las del hilo vecino. Después de una
+                //  barrera se rellenan los huecos entre bandas (trapecios invertidos).
+                //
+                //  Las mallas pueden rotar entre pasos (2 para calor, 3 para ondas): el frente nunca
+                //  sobrescribe una fila que todavía haga falta, y el resultado es el de paso a paso.
+
+                /**
+                 Pasos por bloque
+
+                 @param rows Filas de la banda más estrecha
+                 @param row_bytes Bytes de una fila de todas las mallas que se leen o escriben
+                 @param members Número de bandas
+                 @param lag Filas de retraso de cada paso respecto al anterior en el frente
+                 */
+                inline size_t depth(const size_t &rows, const size_t &row_bytes, const size_t &members, const size_t &lag) {
+                    //  El frente de k pasos tiene unas lag·k+3 filas de cada malla en vuelo
+                    const size_t cached = row_bytes ? CDA_BLOCKING_CACHE / row_bytes : 0;
+                    size_t k = cached > 3 + lag ? (cached - 3) / lag : 1;
+
+                    //  Los huecos entre bandas (2k filas) no pueden tocarse ni llegar a las 3 primeras o últimas filas
+                    if (members > 1) {
+                        k = std::min(k, rows > 3 ? (rows - 3) / 2 : 1);
+                    }
+
+                    return std::max<size_t>(1, std::min<size_t>(k, CDA_BLOCKING_STEPS));
+                }
+
+                /**
+                 Trapecio de la banda [lo, hi): op(t, i) calcula la fila i del paso t del bloque.
+                 Las filas del paso t son [lo + t, hi - t), sin estrecharse en los lados first y last de la malla
+                 */
+                template <typename Op>
+                void trapezoid(const size_t &lo, const size_t &hi, const bool &first, const bool &last,
+                               const size_t &steps, const size_t &lag, const Op &op) {
+                    for (size_t p = lo; p < hi + lag*(steps - 1); ++p) {
+                        for (size_t t = 0; t < steps && lag*t <= p; ++t) {
+                            const size_t i = p - lag*t;
+                            if (i >= (first ? lo : lo + t) && i + (last ? 0 : t) < hi) {
+                                op(t, i);
+                            }
+                        }
+                    }
+                }
+
+                /**
+                 Hueco alrededor de la frontera edge entre dos bandas: filas [edge - t, edge + t) del paso t
+                 */
+                template <typename Op>
+                void gap(const size_t &edge, const size_t &steps, const size_t &lag, const Op &op) {
+                    for (size_t p = edge - 1 + lag; p < edge + (lag + 1)*(steps - 1); ++p) {
+                        for (size_t t = 1; t < steps && lag*t <= p; ++t) {
+                            const size_t i = p - lag*t;
+                            if (i + t >= edge && i < edge + t) {
+                                op(t, i);
+                            }
+                        }
+                    }
+                }
+
+                /**
+                 Número de bandas en que advance() y touch() reparten n filas
+                 */
+                inline size_t bands(const size_t &n, const size_t &members) {
+                    return std::max<size_t>(1, std::min({members, n / 3, parallel::Team::shared().size()}));
+                }
+
+                /**
+                 Reparte n filas en count bandas seguidas con el mismo coste. La banda k son las filas
+                 [bounds[k], bounds[k+1]) y tiene al menos 3 filas (count debe ser como mucho n/3)
+
+                 @param cost cost(i), coste de calcular la fila i
+                 */
+                template <typename Cost>
+                std::vector<size_t> balance(const size_t &n, const size_t &count, const Cost &cost) {
+                    std::vector<size_t> prefix(n + 1, 0);
+                    for (size_t i = 0; i < n; ++i) {
+                        prefix[i + 1] = prefix[i] + cost(i);
+                    }
+
+                    std::vector<size_t> bounds(count + 1, n);
+                    bounds[0] = 0;
+                    for (size_t k = 1; k < count; ++k) {
+                        const size_t target = prefix[n] * k / count;
+                        const size_t i = std::lower_bound(prefix.begin(), prefix.end(), target) - prefix.begin();
+                        bounds[k] = std::min(std::max(i, bounds[k-1] + 3), n - 3*(count - k));
+                    }
+                    return bounds;
+                }
+
+                /**
+                 Bandas iguales: las de parallel::Team::Member::range()
+                 */
+                inline std::vector<size_t> balance(const size_t &n, const size_t &count) {
+                    return balance(n, count, [](const size_t &) { return 1; });
+                }
+
+                /**
+                 Banda [lo, hi) de member. Si el equipo no ha podido dar un hilo a cada banda
+                 (p. ej. en una llamada anidada) se reparte por igual entre los que haya
+                 */
+                inline void band(const size_t &n, const std::vector<size_t> &bounds, const parallel::Team::Member &member,
+                                 size_t &lo, size_t &hi) {
+                    if (member.count() == bounds.size() - 1) {
+                        lo = bounds[member.index()];
+                        hi = bounds[member.index() + 1];
+                    } else {
+                        member.range(0, n, lo, hi);
+                    }
+                }
+
+                /**
+                 Llama a op(lo, hi) para las bandas de filas [lo, hi) que advance() da a cada hilo, desde ese hilo.
+                 Si cada hilo escribe primero sus filas (p. ej. al copiar la condición inicial), las páginas
+                 quedan en su nodo NUMA y advance() sólo lee memoria local (ver parallel::Team::pin)
+
+                 @param bounds Fronteras de las bandas (balance())
+                 */
+                template <typename Op>
+                void touch(const size_t &n, const std::vector<size_t> &bounds, const Op &op) {
+                    parallel::Team::shared().run([&](const parallel::Team::Member &member) {
+                        size_t lo, hi;
+                        band(n, bounds, member, lo, hi);
+                        if (lo < hi) {
+                            op(lo, hi);
+                        }
+                    }, bounds.size() - 1);
+                }
+
+                template <typename Op>
+                void touch(const size_t &n, const size_t &members, const Op &op) {
+                    touch(n, balance(n, bands(n, members)), op);
+                }
+
+                /**
+                 Avanza \p steps pasos sobre n filas con el equipo compartido.
+                 op(s, i) calcula la fila i del paso s y puede leer las filas i-1, i, i+1 de los pasos anteriores.
+                 Puede llamarse a la vez desde varios hilos con filas distintas.
+
+                 Las 3 primeras y las 3 últimas filas siempre son del mismo hilo, así que op puede leer además
+                 las filas del mismo paso ya calculadas entre ellas (p. ej. para las esquinas). Si lo hace en
+                 la fila 2, lag debe ser 2 para que el paso siguiente no empiece antes
+
+                 @param row_bytes Bytes de una fila de todas las mallas que se leen o escriben
+                 @param bounds Fronteras de las bandas de cada hilo (balance()), p. ej. con el mismo coste
+                 @param lag Filas de retraso de cada paso respecto al anterior en el frente (1 o 2)
+                 */
+                template <typename Op>
+                void advance(const size_t &n, const size_t &steps, const size_t &row_bytes, const std::vector<size_t> &bounds,
+                             const size_t &lag, const Op &op) {
+                    if (steps == 0) {
+                        return;
+                    }
+
+                    size_t narrowest = n;
+                    for (size_t k = 0; k + 1 < bounds.size(); ++k) {
+                        narrowest = std::min(narrowest, bounds[k + 1] - bounds[k]);
+                    }
+
+                    parallel::Team::shared().run([&](const parallel::Team::Member &member) {
+                        size_t lo, hi;
+                        band(n, bounds, member, lo, hi);
+
+                        const size_t count = member.count();
+                        const bool first = member.index() == 0, last = member.index() == count - 1;
+                        const size_t k = depth(count == bounds.size() - 1 ? narrowest : n / count, row_bytes, count, lag);
+
+                        for (size_t s0 = 0; s0 < steps; s0 += k) {
+                            const size_t block = std::min(k, steps - s0);
+                            const auto step = [&](const size_t &t, const size_t &i) { op(s0 + t, i); };
+
+                            trapezoid(lo, hi, first, last, block, lag, step);
+
+                            if (count > 1 && block > 1) {
+                                member.barrier();
+                                if (!last) {
+                                    gap(hi, block, lag, step);
+                                }
+                            }
+
+                            if (s0 + block < steps) {
+                                member.barrier();
+                            }
+                        }
+                    }, bounds.size() - 1);
+                }
+
+                /**
+                 Avanza \p steps pasos con bandas iguales
+
+                 @param members Número máximo de hilos
+                 */
+                template <typename Op>
+                void advance(const size_t &n, const size_t &steps, const size_t &row_bytes, const size_t &members,
+                             const size_t &lag, const Op &op) {
+                    advance(n, steps, row_bytes, balance(n, bands(n, members)), lag, op);
+                }
+
+            } /* namespace blocking */
+        } /* namespace differential_equations */
+    } /* namespace math */
+} /* namespace cda */
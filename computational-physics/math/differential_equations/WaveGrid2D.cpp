@@ -0,0 +1,98 @@
+//
+//  WaveGrid2D.cpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#include "WaveGrid2D.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+template <typename Precision>
+WaveGrid2D<Precision>::WaveGrid2D(EDP_T time, EDP_T dt,
+                                  const Vector<EDP_T> &x, const Vector<EDP_T> &y,
+                                  const Matrix<EDP_T> &cI, const Matrix<EDP_T> &cId, const Matrix<bool> &fixed) :
+n(y.size()), m(x.size()), _time(time), _dt(dt), _steps(0),
+x(x), y(y), _previous(cI.rows(), cI.columns()), _current(cI.rows(), cI.columns()), _next(cI.rows(), cI.columns()),
+velocity(cId.rows(), cId.columns()), _fixed(fixed)
+{
+    if (n < 3 || m < 3) {
+        throw std::logic_error("WaveSolver2D necesita al menos 3 puntos en cada dirección");
+    }
+
+    if (cI.rows() != n || cI.columns() != m || cId.rows() != n || cId.columns() != m ||
+        fixed.rows() != n || fixed.columns() != m) {
+        throw std::logic_error("Las dimensiones de cI, cId y fixed deben coincidir con las de y, x");
+    }
+
+    dx = spacing(x);
+    dy = spacing(y);
+
+    balance();
+
+    //  Primera escritura de cada fila desde el hilo que la calcula en advance()
+    blocking::touch(n, bounds, [&](const size_t &lo, const size_t &hi) {
+        for (size_t i = lo; i < hi; ++i) {
+            std::copy(cI[i], cI[i] + m, _previous[i]);
+            std::copy(cI[i], cI[i] + m, _current[i]);
+            std::copy(cI[i], cI[i] + m, _next[i]);
+            std::copy(cId[i], cId[i] + m, velocity[i]);
+        }
+    });
+}
+
+template <typename Precision>
+EDP_T WaveGrid2D<Precision>::spacing(const Vector<EDP_T> &x)
+{
+    const size_t m = x.size();
+    return std::abs((x[m-1] - x[0])/(m-1));
+}
+
+template <typename Precision>
+EDP_T WaveGrid2D<Precision>::stableTimeStep(const EDP_T &dt, const EDP_T &q, const EDP_T &dx, const EDP_T &dy)
+{
+    const EDP_T dt_max = dx*dy/(sqrt(q*(dx*dx+dy*dy)));
+    return dt > dt_max ? dt_max * 0.9 : dt;
+}
+
+template <typename Precision>
+void WaveGrid2D<Precision>::limitTimeStep(const EDP_T &q)
+{
+    _dt = stableTimeStep(_dt, q, dx, dy);
+}
+
+template <typename Precision>
+void WaveGrid2D<Precision>::setFixed(const Matrix<bool> &fixed)
+{
+    if (fixed.rows() != n || fixed.columns() != m) {
+        throw std::logic_error("Las dimensiones de fixed deben coincidir con las de y, x");
+    }
+
+    //  solveWAVE la pasa en cada llamada: sólo se reparte de nuevo si cambia
+    if (_fixed.matches(fixed)) {
+        return;
+    }
+
+    _fixed.assign(fixed);
+    balance();
+}
+
+template <typename Precision>
+void WaveGrid2D<Precision>::balance()
+{
+    bounds = blocking::balance(n, blocking::bands(n, members()), [this](const size_t &i) {
+        return wave::cells(_fixed, i, n, m);
+    });
+}
+
+template class cda::math::differential_equations::WaveGrid2D<DoublePrecision>;
+template class cda::math::differential_equations::WaveGrid2D<SinglePrecision>;
+template class cda::math::differential_equations::WaveGrid2D<MixedPrecision>;
@@ -0,0 +1,178 @@
+//
+//  WaveGrid2D.h
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "SolveEDP.h"
+#include "Precision.h"
+#include "FixedMask.h"
+#include "WaveKernels.h"
+#include "TemporalBlocking.h"
+
+
+namespace cda {
+    namespace math {
+        namespace differential_equations {
+
+            //  -- MALLAS Y AVANCE EN EL TIEMPO DE LA ECUACIÓN DE ONDAS EN 2 DIMENSIONES --
+            //  Base común de WaveSolver2D y StaticWaveSolver2D.
+            //
+            //  Es dueña de tres mallas (anterior, actual y siguiente) reservadas al construirla.
+            //  Cada paso escribe la siguiente a partir de las otras dos y las rota intercambiando punteros,
+            //  así que avanzar en el tiempo no copia ni reserva memoria.
+            //
+            //  Las filas se reparten entre los hilos de parallel::Team::shared(), que siguen vivos entre pasos:
+            //  advance(n, ...) hace un único reparto y cada hilo avanza varios pasos seguidos sobre su banda
+            //  con bloqueo temporal (TemporalBlocking.h), con el mismo resultado que paso a paso.
+            //  Cada hilo copia el estado inicial de su banda al construirla, así que con los hilos fijados
+            //  a una CPU (CDA_AFFINITY) sus filas están en la memoria de su nodo NUMA.
+            //
+            //  Las bandas no tienen el mismo número de filas sino de puntos a calcular: las filas que cruzan
+            //  un obstáculo (tramos largos de puntos fijos) cuestan menos y su banda tiene más filas.
+            //
+            //  Las mallas son de Precision::value_type y los puntos se calculan en Precision::compute_type
+            //  (Precision.h). Las coordenadas, el tiempo y dt son siempre EDP_T.
+            template <typename Precision>
+            class WaveGrid2D {
+            public:
+                typedef typename Precision::value_type value_type;
+
+                //  Estado actual. Puede modificarse entre pasos (p. ej. para aplicar una fuerza externa)
+                containers::Matrix<value_type> &current() { return _current; }
+                const containers::Matrix<value_type> &current() const { return _current; }
+
+                //  Estado en el paso anterior
+                const containers::Matrix<value_type> &previous() const { return _previous; }
+
+                //  Máscara de puntos fijos
+                const FixedMask &fixed() const { return _fixed; }
+
+                /**
+                 Cambia los puntos fijos. Puede llamarse entre pasos
+                 */
+                void setFixed(const containers::Matrix<bool> &fixed);
+
+                EDP_T time() const { return _time; }
+                EDP_T dt() const { return _dt; }
+                size_t steps() const { return _steps; }
+                size_t rows() const { return n; }
+                size_t columns() const { return m; }
+
+                /**
+                 Distancia entre dos puntos consecutivos de \p x (malla uniforme)
+                 */
+                static EDP_T spacing(const containers::Vector<EDP_T> &x);
+
+                /**
+                 Condición CFL: \p dt, o un paso menor si es demasiado grande para el coeficiente \p q
+                 */
+                static EDP_T stableTimeStep(const EDP_T &dt, const EDP_T &q, const EDP_T &dx, const EDP_T &dy);
+
+            protected:
+
+                /**
+                 @param time Instante inicial
+                 @param dt Paso de tiempo
+                 @param x Coordenadas de las columnas
+                 @param y Coordenadas de las filas
+                 @param cI Condición inicial. Se convierte a value_type
+                 @param cId Derivada temporal inicial. Se convierte a value_type
+                 @param fixed Puntos que no evolucionan
+                 */
+                WaveGrid2D(EDP_T time, EDP_T dt,
+                           const containers::Vector<EDP_T> &x, const containers::Vector<EDP_T> &y,
+                           const containers::Matrix<EDP_T> &cI, const containers::Matrix<EDP_T> &cId,
+                           const containers::Matrix<bool> &fixed);
+
+                /**
+                 Condición CFL: si dt es demasiado grande para el coeficiente \p q se reduce
+                 */
+                void limitTimeStep(const EDP_T &q);
+
+                //  Máximo número de hilos entre los que se reparten las filas
+                size_t members() const { return std::max<size_t>(1, n*m / CDA_TEAM_GRAIN); }
+
+                /**
+                 Reparte las filas entre los hilos con el mismo número de puntos a calcular en cada banda,
+                 sin contar los tramos largos de puntos fijos (wave::spans). Se repite al cambiar la máscara
+                 */
+                void balance();
+
+                /**
+                 Avanza \p steps pasos de tiempo
+
+                 @param q Coeficiente q(i, j)
+                 @param bc Condiciones de contorno: unsigned char o std::integral_constant si se conocen al compilar
+                 @param b Condiciones de contorno en cada borde: left(i), right(i), top(j), bottom(j)
+                 */
+                template <typename Coefficient, typename Flags, typename Boundaries>
+                void advance(size_t steps, const Coefficient &q, const Flags &bc, const Boundaries &b);
+
+                size_t n, m;
+                EDP_T _time, _dt, dx, dy;
+                size_t _steps;
+
+                containers::Vector<EDP_T> x, y;
+                containers::Matrix<value_type> _previous, _current, _next;
+                containers::Matrix<value_type> velocity;    //  Sólo se usa en el primer paso
+                FixedMask _fixed;
+
+                //  Bandas de filas de cada hilo (blocking::balance)
+                std::vector<size_t> bounds;
+            };
+
+
+            template <typename Precision>
+            template <typename Coefficient, typename Flags, typename Boundaries>
+            void WaveGrid2D<Precision>::advance(size_t steps, const Coefficient &q, const Flags &bc, const Boundaries &b)
+            {
+                if (steps == 0) {
+                    return;
+                }
+
+                //  En el paso s: anterior = grid[s%3], actual = grid[(s+1)%3], siguiente = grid[(s+2)%3]
+                containers::Matrix<value_type> *grid[] = {&_previous, &_current, &_next};
+                const wave::Stencil stencil = {n, m, dx, dy, _dt};
+                const size_t first = _steps;
+
+                //  Cada fila lee las tres mallas y el coeficiente
+                const size_t row_bytes = 4 * m * sizeof(value_type);
+
+                blocking::advance(n, steps, row_bytes, bounds, 1, [&](const size_t &s, const size_t &i) {
+                    const containers::Matrix<value_type> &previous = *grid[s % 3], &current = *grid[(s+1) % 3];
+                    containers::Matrix<value_type> &next = *grid[(s+2) % 3];
+
+                    if (first + s == 0) {
+                        wave::row<wave::FirstStep, Precision>(stencil, bc, q, b, current, velocity, _fixed, next, i);
+                    } else {
+                        wave::row<wave::Leapfrog, Precision>(stencil, bc, q, b, current, previous, _fixed, next, i);
+                    }
+                });
+
+                //  Rotación: anterior <- actual <- siguiente. Sólo se intercambian punteros
+                for (size_t s = 0; s < steps % 3; ++s) {
+                    _previous.swap(_current);
+                    _current.swap(_next);
+                }
+
+                if (first == 0) {
+                    velocity.clear();
+                }
+
+                for (size_t s = 0; s < steps; ++s) {
+                    _time += _dt;
+                }
+                _steps += steps;
+            }
+
+        } /* namespace differential_equations */
+    } /* namespace math */
+} /* namespace cda */
@@ -0,0 +1,259 @@
+//
+//  WaveKernels.cpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+//  FirstStep::update y Leapfrog::update devuelven vectores AVX sin estar compiladas con AVX.
+//  Siempre se expanden dentro de los núcleos (CDA_WAVE_INLINE), así que el aviso de ABI no aplica
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+//  AVX-512 incluye FMA: sin esto el compilador fusiona productos y sumas y los resultados ya no son
+//  exactamente los del bucle escalar
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+#include "WaveKernels.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CDA_WAVE_X86
+#include <immintrin.h>
+#endif
+
+using namespace cda::math::differential_equations;
+using namespace cda::math::differential_equations::wave;
+
+
+namespace {
+
+    //  Celdas [from, m-1) de la fila con el bucle escalar. También hace las colas de los núcleos vectoriales
+    template <typename Scheme, bool Uniform, typename Precision>
+    void scalar_cells(const simd::Row<typename Precision::value_type> &row, const Stencil &stencil, size_t from) {
+        typedef typename Precision::value_type T;
+        typedef typename Precision::compute_type S;
+
+        const size_t m = stencil.m;
+        const S dx = stencil.dx, dy = stencil.dy, dt = stencil.dt;
+        const S dx2 = dx*dx, dy2 = dy*dy;
+        const T *up = row.up, *c = row.c, *down = row.down, *o = row.other, *q = row.q;
+        T *sol = row.sol;
+
+        for (size_t j = from; j < m-1; ++j) {
+            const S cj = c[j];
+            const S lap = (S(down[j])-S(2)*cj+up[j])/dy2 + (S(c[j+1])-S(2)*cj+c[j-1])/dx2;
+            sol[j] = T(Scheme::update(cj, S(o[j]), S(Uniform ? row.uniform : q[j]), lap, dt));
+        }
+    }
+
+    template <typename Scheme, bool Uniform, typename Precision>
+    void scalar_row(const simd::Row<typename Precision::value_type> &row, const Stencil &stencil) {
+        scalar_cells<Scheme, Uniform, Precision>(row, stencil, 1);
+    }
+
+#ifdef CDA_WAVE_X86
+
+    //  -- CARGA Y GUARDADO DE VECTORES PARA CADA PRECISIÓN --
+    //  Vector: tipo en el que se opera. width: puntos por vector
+
+    template <typename Precision>
+    struct Avx2;
+
+    template <>
+    struct Avx2<DoublePrecision> {
+        typedef __m256d Vector;
+        static const size_t width = 4;
+
+        __attribute__((target("avx2"))) static CDA_WAVE_INLINE Vector load(const double *p) { return _mm256_loadu_pd(p); }
+        __attribute__((target("avx2"))) static CDA_WAVE_INLINE void store(double *p, const Vector &v) { _mm256_storeu_pd(p, v); }
+        __attribute__((target("avx2"))) static CDA_WAVE_INLINE Vector set1(const double &value) { return _mm256_set1_pd(value); }
+    };
+
+    template <>
+    struct Avx2<SinglePrecision> {
+        typedef __m256 Vector;
+        static const size_t width = 8;
+
+        __attribute__((target("avx2"))) static CDA_WAVE_INLINE Vector load(const float *p) { return _mm256_loadu_ps(p); }
+        __attribute__((target("avx2"))) static CDA_WAVE_INLINE void store(float *p, const Vector &v) { _mm256_storeu_ps(p, v); }
+        __attribute__((target("avx2"))) static CDA_WAVE_INLINE Vector set1(const float &value) { return _mm256_set1_ps(value); }
+    };
+
+    //  4 floats convertidos a double
+    template <>
+    struct Avx2<MixedPrecision> {
+        typedef __m256d Vector;
+        static const size_t width = 4;
+
+        __attribute__((target("avx2"))) static CDA_WAVE_INLINE Vector load(const float *p) { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+        __attribute__((target("avx2"))) static CDA_WAVE_INLINE void store(float *p, const Vector &v) { _mm_storeu_ps(p, _mm256_cvtpd_ps(v)); }
+        __attribute__((target("avx2"))) static CDA_WAVE_INLINE Vector set1(const double &value) { return _mm256_set1_pd(value); }
+    };
+
+    template <typename Precision>
+    struct Avx512;
+
+    template <>
+    struct Avx512<DoublePrecision> {
+        typedef __m512d Vector;
+        static const size_t width = 8;
+
+        __attribute__((target("avx512f"))) static CDA_WAVE_INLINE Vector load(const double *p) { return _mm512_loadu_pd(p); }
+        __attribute__((target("avx512f"))) static CDA_WAVE_INLINE void store(double *p, const Vector &v) { _mm512_storeu_pd(p, v); }
+        __attribute__((target("avx512f"))) static CDA_WAVE_INLINE Vector set1(const double &value) { return _mm512_set1_pd(value); }
+    };
+
+    template <>
+    struct Avx512<SinglePrecision> {
+        typedef __m512 Vector;
+        static const size_t width = 16;
+
+        __attribute__((target("avx512f"))) static CDA_WAVE_INLINE Vector load(const float *p) { return _mm512_loadu_ps(p); }
+        __attribute__((target("avx512f"))) static CDA_WAVE_INLINE void store(float *p, const Vector &v) { _mm512_storeu_ps(p, v); }
+        __attribute__((target("avx512f"))) static CDA_WAVE_INLINE Vector set1(const float &value) { return _mm512_set1_ps(value); }
+    };
+
+    //  8 floats convertidos a double. Las conversiones con máscara completa (maskz) son la misma instrucción,
+    //  pero parten de un registro a cero en lugar de _mm512_undefined_pd(), que con GCC -Wall avisa de
+    //  -Wmaybe-uninitialized en cada instanciación de avx512_row
+    template <>
+    struct Avx512<MixedPrecision> {
+        typedef __m512d Vector;
+        static const size_t width = 8;
+
+        __attribute__((target("avx512f"))) static CDA_WAVE_INLINE Vector load(const float *p) { return _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(p)); }
+        __attribute__((target("avx512f"))) static CDA_WAVE_INLINE void store(float *p, const Vector &v) { _mm256_storeu_ps(p, _mm512_maskz_cvtpd_ps(0xFF, v)); }
+        __attribute__((target("avx512f"))) static CDA_WAVE_INLINE Vector set1(const double &value) { return _mm512_set1_pd(value); }
+    };
+
+    //  Mismas operaciones y en el mismo orden que scalar_row, width columnas por iteración
+    template <typename Scheme, bool Uniform, typename Precision>
+    __attribute__((target("avx2")))
+    void avx2_row(const simd::Row<typename Precision::value_type> &row, const Stencil &stencil) {
+        typedef typename Precision::value_type T;
+        typedef typename Precision::compute_type S;
+        typedef Avx2<Precision> V;
+
+        const size_t m = stencil.m;
+        const S dx = stencil.dx, dy = stencil.dy, dt = stencil.dt;
+        const S dx2 = dx*dx, dy2 = dy*dy;
+        const T *up = row.up, *c = row.c, *down = row.down, *o = row.other, *q = row.q;
+        T *sol = row.sol;
+
+        const typename V::Vector uniform = V::set1(row.uniform);
+
+        size_t j = 1;
+        for (; j + V::width <= m-1; j += V::width) {
+            const typename V::Vector cj = V::load(c + j);
+            const typename V::Vector lap = (V::load(down + j) - S(2)*cj + V::load(up + j))/dy2 +
+                                           (V::load(c + j+1) - S(2)*cj + V::load(c + j-1))/dx2;
+            const typename V::Vector qj = Uniform ? uniform : V::load(q + j);
+            V::store(sol + j, Scheme::update(cj, V::load(o + j), qj, lap, dt));
+        }
+
+        scalar_cells<Scheme, Uniform, Precision>(row, stencil, j);
+    }
+
+    template <typename Scheme, bool Uniform, typename Precision>
+    __attribute__((target("avx512f")))
+    void avx512_row(const simd::Row<typename Precision::value_type> &row, const Stencil &stencil) {
+        typedef typename Precision::value_type T;
+        typedef typename Precision::compute_type S;
+        typedef Avx512<Precision> V;
+
+        const size_t m = stencil.m;
+        const S dx = stencil.dx, dy = stencil.dy, dt = stencil.dt;
+        const S dx2 = dx*dx, dy2 = dy*dy;
+        const T *up = row.up, *c = row.c, *down = row.down, *o = row.other, *q = row.q;
+        T *sol = row.sol;
+
+        const typename V::Vector uniform = V::set1(row.uniform);
+
+        size_t j = 1;
+        for (; j + V::width <= m-1; j += V::width) {
+            const typename V::Vector cj = V::load(c + j);
+            const typename V::Vector lap = (V::load(down + j) - S(2)*cj + V::load(up + j))/dy2 +
+                                           (V::load(c + j+1) - S(2)*cj + V::load(c + j-1))/dx2;
+            const typename V::Vector qj = Uniform ? uniform : V::load(q + j);
+            V::store(sol + j, Scheme::update(cj, V::load(o + j), qj, lap, dt));
+        }
+
+        scalar_cells<Scheme, Uniform, Precision>(row, stencil, j);
+    }
+
+#endif
+
+    simd::Isa detect() {
+        simd::Isa isa = simd::SCALAR;
+
+#ifdef CDA_WAVE_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            isa = simd::AVX512;
+        } else if (__builtin_cpu_supports("avx2")) {
+            isa = simd::AVX2;
+        }
+#endif
+
+        if (const char *limit = std::getenv("CDA_WAVE_SIMD")) {
+            simd::Isa requested = simd::AVX512;
+            if (std::strcmp(limit, "scalar") == 0) {
+                requested = simd::SCALAR;
+            } else if (std::strcmp(limit, "avx2") == 0) {
+                requested = simd::AVX2;
+            }
+            isa = std::min(isa, requested);
+        }
+
+        return isa;
+    }
+
+}
+
+
+simd::Isa simd::supported()
+{
+    static const Isa isa = detect();
+    return isa;
+}
+
+template <typename Scheme, bool Uniform, typename Precision>
+simd::Kernel<typename Precision::value_type> simd::kernel(Isa isa)
+{
+#ifdef CDA_WAVE_X86
+    switch (isa) {
+        case AVX512:
+            return avx512_row<Scheme, Uniform, Precision>;
+        case AVX2:
+            return avx2_row<Scheme, Uniform, Precision>;
+        default:
+            break;
+    }
+#endif
+
+    return scalar_row<Scheme, Uniform, Precision>;
+}
+
+template simd::Kernel<double> simd::kernel<FirstStep, true, DoublePrecision>(Isa isa);
+template simd::Kernel<double> simd::kernel<FirstStep, false, DoublePrecision>(Isa isa);
+template simd::Kernel<double> simd::kernel<Leapfrog, true, DoublePrecision>(Isa isa);
+template simd::Kernel<double> simd::kernel<Leapfrog, false, DoublePrecision>(Isa isa);
+
+template simd::Kernel<float> simd::kernel<FirstStep, true, SinglePrecision>(Isa isa);
+template simd::Kernel<float> simd::kernel<FirstStep, false, SinglePrecision>(Isa isa);
+template simd::Kernel<float> simd::kernel<Leapfrog, true, SinglePrecision>(Isa isa);
+template simd::Kernel<float> simd::kernel<Leapfrog, false, SinglePrecision>(Isa isa);
+
+template simd::Kernel<float> simd::kernel<FirstStep, true, MixedPrecision>(Isa isa);
+template simd::Kernel<float> simd::kernel<FirstStep, false, MixedPrecision>(Isa isa);
+template simd::Kernel<float> simd::kernel<Leapfrog, true, MixedPrecision>(Isa isa);
+template simd::Kernel<float> simd::kernel<Leapfrog, false, MixedPrecision>(Isa isa);
@@ -0,0 +1,392 @@
+//
+//  WaveKernels.h
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+
+#include "SolveEDP.h"
+#include "Precision.h"
+#include "CoefficientField.h"
+#include "FixedMask.h"
+
+
+//  Los esquemas también se instancian con vectores AVX en WaveKernels.cpp: tienen que expandirse
+//  dentro de los núcleos vectoriales incluso sin optimizaciones
+#if defined(__GNUC__)
+#define CDA_WAVE_INLINE inline __attribute__((always_inline))
+#else
+#define CDA_WAVE_INLINE inline
+#endif
+
+//  Puntos fijos seguidos en una fila a partir de los cuales no se calculan (p. ej. un obstáculo)
+#define CDA_WAVE_SKIP 32
+
+
+namespace cda {
+    namespace math {
+        namespace differential_equations {
+            namespace wave {
+
+                //  -- NÚCLEOS DE LA ECUACIÓN DE ONDAS EN 2 DIMENSIONES --
+                //  Compartidos por WaveSolver2D (coeficientes muestreados, condiciones en tiempo de ejecución)
+                //  y StaticWaveSolver2D (funtores y condiciones como parámetros de plantilla).
+                //
+                //  Las expresiones son las mismas que usaba EDP::solveWAVE, en el mismo orden,
+                //  para obtener exactamente los mismos resultados.
+                //
+                //  Todos admiten una Precision: las mallas son de Precision::value_type (T) y cada punto se
+                //  calcula en Precision::compute_type (S). Con DoublePrecision son las operaciones de siempre.
+
+                //  Primer paso: u(dt) = u + dt·v + Q·dt²/2·∆u
+                //  other -> derivada temporal inicial
+                //  update admite S o vectores de S (__m256, __m256d, __m512, __m512d)
+                struct FirstStep {
+                    template <typename V, typename S>
+                    static CDA_WAVE_INLINE V update(const V &c, const V &other, const V &q, const V &lap, const S &dt) {
+                        return c + dt*other + q*dt*dt/S(2)*lap;
+                    }
+
+                    template <typename S>
+                    static inline S corner(const S &c, const S &other, const S &q, const S &lap, const S &dt) {
+                        return c + dt*other + q*dt*dt*lap;
+                    }
+                };
+
+                //  Pasos siguientes: u(t+dt) = 2·u(t) + Q·dt²·∆u - u(t-dt)
+                //  other -> estado anterior
+                struct Leapfrog {
+                    template <typename V, typename S>
+                    static CDA_WAVE_INLINE V update(const V &c, const V &other, const V &q, const V &lap, const S &dt) {
+                        return S(2)*c + dt*dt*q*lap - other;
+                    }
+
+                    template <typename S>
+                    static inline S corner(const S &c, const S &other, const S &q, const S &lap, const S &dt) {
+                        return S(2)*(c + dt*dt*q*lap) - other;
+                    }
+                };
+
+                //  Dimensiones y pasos de la malla
+                struct Stencil {
+                    size_t n, m;
+                    EDP_T dx, dy, dt;
+                };
+
+                //  -- NÚCLEOS VECTORIALES PARA LAS FILAS INTERIORES --
+                //  Escritos a mano con AVX2 y AVX-512 en WaveKernels.cpp y elegidos al ejecutar según la CPU.
+                //  No usan FMA: hacen las mismas operaciones en el mismo orden que el bucle escalar y dan
+                //  exactamente los mismos resultados.
+                //
+                //  En float cada vector tiene el doble de puntos. Con MixedPrecision se cargan floats, se
+                //  convierten a double para operar y el resultado se redondea a float al guardarlo.
+                namespace simd {
+
+                    enum Isa {
+                        SCALAR = 0,
+                        AVX2 = 1,
+                        AVX512 = 2
+                    };
+
+                    //  Fila interior: sol[j] para 0 < j < m-1
+                    template <typename T>
+                    struct Row {
+                        const T *up, *c, *down, *other;
+                        const T *q;         //  Coeficiente en la fila. No se usa si es uniforme
+                        T uniform;
+                        T *sol;
+                    };
+
+                    template <typename T>
+                    using Kernel = void (*)(const Row<T> &row, const Stencil &stencil);
+
+                    /**
+                     Mejor juego de instrucciones disponible en esta CPU.
+                     La variable de entorno CDA_WAVE_SIMD (scalar, avx2 o avx512) permite limitarlo
+                     */
+                    Isa supported();
+
+                    /**
+                     Núcleo para \p isa. Si este ejecutable no lo tiene devuelve el escalar
+                     */
+                    template <typename Scheme, bool Uniform, typename Precision = DoublePrecision>
+                    Kernel<typename Precision::value_type> kernel(Isa isa);
+
+                } /* namespace simd */
+
+                //  -- COEFICIENTES: q(i, j) --
+
+                //  Valor constante en toda la malla
+                template <typename T>
+                struct Uniform {
+                    T value;
+
+                    T operator()(const size_t &, const size_t &) const { return value; }
+                };
+
+                //  Valores muestreados
+                template <typename T>
+                struct Sampled {
+                    const BasicCoefficientField<T> &field;
+
+                    T operator()(const size_t &i, const size_t &j) const { return field[i][j]; }
+                };
+
+                //  Funtor Q(x, y) evaluado en cada punto. El compilador lo puede expandir en línea
+                template <typename Coefficient>
+                struct Evaluated {
+                    const Coefficient &Q;
+                    const containers::Vector<EDP_T> &x, &y;
+
+                    EDP_T operator()(const size_t &i, const size_t &j) const { return Q(x[j], y[i]); }
+                };
+
+                //  Q(x, y) = value
+                struct Constant {
+                    EDP_T value;
+
+                    constexpr EDP_T operator()(const EDP_T &, const EDP_T &) const { return value; }
+                };
+
+                //  Condición de contorno nula
+                struct Zero {
+                    constexpr EDP_T operator()(const EDP_T &, const EDP_T &) const { return 0.0; }
+                };
+
+                //  -- CONDICIONES DE CONTORNO: left(i), right(i), top(j), bottom(j) --
+
+                //  Valores muestreados en cada borde
+                struct SampledBoundaries {
+                    const containers::Vector<EDP_T> &l, &r, &t, &b;
+
+                    EDP_T left(const size_t &i) const { return l[i]; }
+                    EDP_T right(const size_t &i) const { return r[i]; }
+                    EDP_T top(const size_t &j) const { return t[j]; }
+                    EDP_T bottom(const size_t &j) const { return b[j]; }
+                };
+
+                //  Funtores BC(x, y) evaluados en cada punto del borde
+                template <typename Left, typename Right, typename Top, typename Bottom>
+                struct EvaluatedBoundaries {
+                    const Left &l;
+                    const Right &r;
+                    const Top &t;
+                    const Bottom &b;
+                    const containers::Vector<EDP_T> &x, &y;
+
+                    EDP_T left(const size_t &i) const { return l(x[0], y[i]); }
+                    EDP_T right(const size_t &i) const { return r(x[x.size()-1], y[i]); }
+                    EDP_T top(const size_t &j) const { return t(x[j], y[0]); }
+                    EDP_T bottom(const size_t &j) const { return b(x[j], y[y.size()-1]); }
+                };
+
+                /**
+                 Restaura los puntos fijos interiores de la fila i. La primera y la última columna son de edges
+                 */
+                template <typename T>
+                void restore(const FixedMask &fixed, const size_t &i, const size_t &m, const T *c, T *sol) {
+                    for (const size_t *j = fixed.begin(i); j != fixed.end(i); ++j) {
+                        if (*j > 0 && *j < m-1) {
+                            sol[*j] = c[*j];
+                        }
+                    }
+                }
+
+                /**
+                 Llama a op(from, to) para los tramos de columnas interiores [from, to) de la fila i que hay que calcular:
+                 todas menos los tramos de al menos CDA_WAVE_SKIP puntos fijos seguidos
+                 */
+                template <typename Op>
+                void spans(const FixedMask &fixed, const size_t &i, const size_t &m, const Op &op) {
+                    size_t from = 1;
+                    const size_t *j = fixed.begin(i), *end = fixed.end(i);
+                    while (j != end) {
+                        const size_t *k = j + 1;
+                        while (k != end && *k == *(k-1) + 1) {
+                            ++k;
+                        }
+
+                        const size_t first = std::max<size_t>(*j, 1), last = std::min(*(k-1) + 1, m-1);
+                        if (last > first && last - first >= CDA_WAVE_SKIP) {
+                            if (first > from) {
+                                op(from, first);
+                            }
+                            from = last;
+                        }
+                        j = k;
+                    }
+
+                    if (from < m-1) {
+                        op(from, m-1);
+                    }
+                }
+
+                /**
+                 Puntos que calcula row() en la fila i de una malla n×m con la máscara \p fixed
+                 */
+                inline size_t cells(const FixedMask &fixed, const size_t &i, const size_t &n, const size_t &m) {
+                    if (i == 0 || i == n-1) {
+                        return m;
+                    }
+
+                    size_t count = 2;
+                    spans(fixed, i, m, [&count](const size_t &from, const size_t &to) { count += to - from; });
+                    return count;
+                }
+
+                /**
+                 Puntos interiores de la fila i de next, sin la primera ni la última columna
+                 */
+                template <typename Scheme, typename Precision, typename Coefficient, typename T>
+                void interior(const Stencil &stencil, const Coefficient &q,
+                              const containers::Matrix<T> &current, const containers::Matrix<T> &other,
+                              const FixedMask &fixed, containers::Matrix<T> &next, const size_t &i) {
+                    typedef typename Precision::compute_type S;
+
+                    const size_t m = stencil.m;
+                    const S dx = stencil.dx, dy = stencil.dy, dt = stencil.dt;
+                    const S dx2 = dx*dx, dy2 = dy*dy;
+
+                    const T *up = current[i-1], *c = current[i], *down = current[i+1];
+                    const T *o = other[i];
+                    T *sol = next[i];
+
+                    //  Se calcula la fila sin consultar la máscara (salvo los tramos largos de puntos fijos)
+                    //  y después se restauran los puntos fijos
+                    spans(fixed, i, m, [&](const size_t &from, const size_t &to) {
+                        for (size_t j = from; j < to; ++j) {
+                            const S cj = c[j];
+                            const S lap = (S(down[j])-S(2)*cj+up[j])/dy2 + (S(c[j+1])-S(2)*cj+c[j-1])/dx2;
+                            sol[j] = T(Scheme::update(cj, S(o[j]), S(q(i,j)), lap, dt));
+                        }
+                    });
+
+                    restore(fixed, i, m, c, sol);
+                }
+
+                /**
+                 Puntos interiores con el núcleo vectorial de simd::supported()
+                 */
+                template <typename Scheme, typename Precision, bool Uniform, typename T>
+                void interior(const Stencil &stencil, const T &uniform, const BasicCoefficientField<T> *field,
+                              const containers::Matrix<T> &current, const containers::Matrix<T> &other,
+                              const FixedMask &fixed, containers::Matrix<T> &next, const size_t &i) {
+                    static const simd::Kernel<T> kernel = simd::kernel<Scheme, Uniform, Precision>(simd::supported());
+
+                    //  Cada tramo es una fila más corta: columnas [from - 1, to + 1)
+                    spans(fixed, i, stencil.m, [&](const size_t &from, const size_t &to) {
+                        const size_t j = from - 1;
+                        const simd::Row<T> row = {current[i-1] + j, current[i] + j, current[i+1] + j, other[i] + j,
+                                                  Uniform ? nullptr : (*field)[i] + j, uniform, next[i] + j};
+                        const Stencil span = {stencil.n, to - from + 2, stencil.dx, stencil.dy, stencil.dt};
+                        kernel(row, span);
+                    });
+                    restore(fixed, i, stencil.m, current[i], next[i]);
+                }
+
+                template <typename Scheme, typename Precision, typename T>
+                void interior(const Stencil &stencil, const Uniform<T> &q,
+                              const containers::Matrix<T> &current, const containers::Matrix<T> &other,
+                              const FixedMask &fixed, containers::Matrix<T> &next, const size_t &i) {
+                    interior<Scheme, Precision, true>(stencil, q.value, (const BasicCoefficientField<T> *)nullptr, current, other, fixed, next, i);
+                }
+
+                template <typename Scheme, typename Precision, typename T>
+                void interior(const Stencil &stencil, const Sampled<T> &q,
+                              const containers::Matrix<T> &current, const containers::Matrix<T> &other,
+                              const FixedMask &fixed, containers::Matrix<T> &next, const size_t &i) {
+                    interior<Scheme, Precision, false>(stencil, T(0), &q.field, current, other, fixed, next, i);
+                }
+
+                /**
+                 Fila i completa de sol, bordes y esquinas incluidos. Sólo lee las filas i-1, i, i+1 de c y la fila i de other.
+                 Los bordes sin condición en la derivada y los puntos fijos no cambian.
+
+                 @param bc Condiciones de contorno: unsigned char o std::integral_constant si se conocen al compilar
+                 */
+                template <typename Scheme, typename Precision, typename Flags, typename Coefficient, typename Boundaries, typename T>
+                void row(const Stencil &stencil, const Flags &bc, const Coefficient &q, const Boundaries &b,
+                         const containers::Matrix<T> &c, const containers::Matrix<T> &other,
+                         const FixedMask &fixed, containers::Matrix<T> &sol, const size_t &i) {
+                    typedef typename Precision::compute_type S;
+
+                    const size_t n = stencil.n, m = stencil.m;
+                    const S dx = stencil.dx, dy = stencil.dy, dt = stencil.dt;
+                    const S dx2 = dx*dx, dy2 = dy*dy;
+
+                    if (i == 0) {
+                        std::copy(c[0], c[0] + m, sol[0]);
+
+                        if (bc & BCT_df) {  //  Condición en el borde superior de la membrana
+                            for (size_t j=1; j<m-1; j++) {
+                                if (!fixed(0,j)) {
+                                    const S lap = (S(2)*c[1][j]-S(2)*dy*S(b.top(j))-S(2)*c[0][j])/dy2 + (S(c[0][j+1])-S(2)*c[0][j]+c[0][j-1])/dx2;
+                                    sol[0][j] = T(Scheme::update(S(c[0][j]), S(other[0][j]), S(q(0,j)), lap, dt));
+                                }
+                            }
+                        }
+
+                        //  Esquinas
+                        if (bc & BCL_df && bc & BCT_df && !fixed(0,0)) {
+                            const S lap = (S(c[1][0])-c[0][0]-dy*S(b.top(0)))/dy2 + (S(c[0][1])-c[0][0]-dx*S(b.left(0)))/dx2;
+                            sol[0][0] = T(Scheme::corner(S(c[0][0]), S(other[0][0]), S(q(0,0)), lap, dt));
+                        }
+
+                        if (bc & BCT_df && bc & BCR_df && !fixed(0,m-1)) {
+                            const S lap = (S(c[1][m-1])-c[0][m-1]-dy*S(b.top(m-1)))/dy2 + (S(c[0][m-2])-c[0][m-1]+dx*S(b.right(0)))/dx2;
+                            sol[0][m-1] = T(Scheme::corner(S(c[0][m-1]), S(other[0][m-1]), S(q(0,m-1)), lap, dt));
+                        }
+
+                        return;
+                    }
+
+                    if (i == n-1) {
+                        std::copy(c[n-1], c[n-1] + m, sol[n-1]);
+
+                        if (bc & BCB_df) {  //  Condición en el borde inferior de la membrana
+                            for (size_t j=1; j<m-1; j++) {
+                                if (!fixed(n-1,j)) {
+                                    const S lap = (S(2)*c[n-2][j]+S(2)*dy*S(b.bottom(j))-S(2)*c[n-1][j])/dy2 + (S(c[n-1][j+1])-S(2)*c[n-1][j]+c[n-1][j-1])/dx2;
+                                    sol[n-1][j] = T(Scheme::update(S(c[n-1][j]), S(other[n-1][j]), S(q(n-1,j)), lap, dt));
+                                }
+                            }
+                        }
+
+                        //  Esquinas
+                        if (bc & BCL_df && bc & BCB_df && !fixed(n-1,0)) {
+                            const S lap = (S(c[n-2][0])-c[n-1][0]+dy*S(b.bottom(0)))/dy2 + (S(c[n-1][1])-c[n-1][0]-dx*S(b.left(n-1)))/dx2;
+                            sol[n-1][0] = T(Scheme::corner(S(c[n-1][0]), S(other[n-1][0]), S(q(n-1,0)), lap, dt));
+                        }
+
+                        if (bc & BCB_df && bc & BCR_df && !fixed(n-1,m-1)) {
+                            const S lap = (S(c[n-2][m-1])-c[n-1][m-1]+dy*S(b.bottom(m-1)))/dy2 + (S(c[n-1][m-2])-c[n-1][m-1]+dx*S(b.right(n-1)))/dx2;
+                            sol[n-1][m-1] = T(Scheme::corner(S(c[n-1][m-1]), S(other[n-1][m-1]), S(q(n-1,m-1)), lap, dt));
+                        }
+
+                        return;
+                    }
+
+                    interior<Scheme, Precision>(stencil, q, c, other, fixed, sol, i);
+
+                    sol[i][0] = c[i][0];
+                    if (bc & BCL_df && !fixed(i,0)) {   //  Condición en el borde izquierdo de la membrana
+                        const S lap = (S(c[i+1][0])-S(2)*c[i][0]+c[i-1][0])/dy2 + (S(2)*c[i][1]-S(2)*dx*S(b.left(i))-S(2)*c[i][0])/dx2;
+                        sol[i][0] = T(Scheme::update(S(c[i][0]), S(other[i][0]), S(q(i,0)), lap, dt));
+                    }
+
+                    sol[i][m-1] = c[i][m-1];
+                    if (bc & BCR_df && !fixed(i,m-1)) { //  Condición en el borde derecho de la membrana
+                        const S lap = (S(c[i+1][m-1])-S(2)*c[i][m-1]+c[i-1][m-1])/dy2 + (S(2)*c[i][m-2]+S(2)*dx*S(b.right(i))-S(2)*c[i][m-1])/dx2;
+                        sol[i][m-1] = T(Scheme::update(S(c[i][m-1]), S(other[i][m-1]), S(q(i,m-1)), lap, dt));
+                    }
+                }
+
+            } /* namespace wave */
+        } /* namespace differential_equations */
+    } /* namespace math */
+} /* namespace cda */
@@ -0,0 +1,127 @@
+//
+//  WaveSolver2D.cpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#include "WaveSolver2D.h"
+
+#include <stdexcept>
+
+using namespace cda::math::containers;
+using namespace cda::math::differential_equations;
+
+
+template <typename Precision>
+BasicWaveSolver2D<Precision>::BasicWaveSolver2D(const EDP &equation, unsigned char bc,
+                                                const Vector<EDP_T> &x, const Vector<EDP_T> &y,
+                                                const Matrix<EDP_T> &cI, const Matrix<EDP_T> &cId, const Matrix<bool> &fixed) :
+WaveGrid2D<Precision>(equation.time, equation.dt, x, y, cI, cId, fixed), bc(bc),
+BCL(nullptr), BCR(nullptr), BCT(nullptr), BCB(nullptr)
+{
+    setCoefficients(equation);
+    this->limitTimeStep(Q(0,0));
+}
+
+template <typename Precision>
+BasicWaveSolver2D<Precision>::BasicWaveSolver2D(EDP_T time, EDP_T dt, unsigned char bc,
+                                                const Vector<EDP_T> &x, const Vector<EDP_T> &y,
+                                                const Matrix<EDP_T> &cI, const Matrix<EDP_T> &cId, const Matrix<bool> &fixed,
+                                                const Matrix<EDP_T> &q, const wave::SampledBoundaries &boundaries) :
+WaveGrid2D<Precision>(time, dt, x, y, cI, cId, fixed), bc(bc),
+BCL(nullptr), BCR(nullptr), BCT(nullptr), BCB(nullptr)
+{
+    setCoefficients(q, boundaries);
+}
+
+template <typename Precision>
+void BasicWaveSolver2D<Precision>::step(size_t steps)
+{
+    const wave::SampledBoundaries boundaries = {left, right, top, bottom};
+
+    if (Q.is_uniform()) {
+        this->advance(steps, wave::Uniform<value_type>{Q.value()}, bc, boundaries);
+    } else {
+        this->advance(steps, wave::Sampled<value_type>{Q}, bc, boundaries);
+    }
+}
+
+template <typename Precision>
+void BasicWaveSolver2D<Precision>::setCoefficients(const EDP &equation, bool cache)
+{
+    const size_t n = this->n, m = this->m;
+    const Vector<EDP_T> &x = this->x, &y = this->y;
+
+    if (!cache || !Q.samples(equation.Q2D, x, y)) {
+        Q.sample(equation.Q2D, x, y);
+    }
+
+    //  Las condiciones de contorno sólo se evalúan en los bordes con condición en la derivada
+    if (bc & BCL_df && (!cache || left.is_empty() || BCL != equation.BCL)) {
+        BCL = equation.BCL;
+        left.resize(n);
+        for (size_t i=0; i<n; i++) {
+            left[i] = BCL(x[0],y[i]);
+        }
+    }
+
+    if (bc & BCR_df && (!cache || right.is_empty() || BCR != equation.BCR)) {
+        BCR = equation.BCR;
+        right.resize(n);
+        for (size_t i=0; i<n; i++) {
+            right[i] = BCR(x[m-1],y[i]);
+        }
+    }
+
+    if (bc & BCT_df && (!cache || top.is_empty() || BCT != equation.BCT)) {
+        BCT = equation.BCT;
+        top.resize(m);
+        for (size_t j=0; j<m; j++) {
+            top[j] = BCT(x[j],y[0]);
+        }
+    }
+
+    if (bc & BCB_df && (!cache || bottom.is_empty() || BCB != equation.BCB)) {
+        BCB = equation.BCB;
+        bottom.resize(m);
+        for (size_t j=0; j<m; j++) {
+            bottom[j] = BCB(x[j],y[n-1]);
+        }
+    }
+}
+
+template <typename Precision>
+void BasicWaveSolver2D<Precision>::setCoefficients(const Matrix<EDP_T> &q, const wave::SampledBoundaries &boundaries)
+{
+    if (q.rows() != this->n || q.columns() != this->m) {
+        throw std::logic_error("Las dimensiones de q deben coincidir con las de y, x");
+    }
+
+    if ((bc & BCL_df && boundaries.l.size() != this->n) || (bc & BCR_df && boundaries.r.size() != this->n) ||
+        (bc & BCT_df && boundaries.t.size() != this->m) || (bc & BCB_df && boundaries.b.size() != this->m)) {
+        throw std::logic_error("Las condiciones de contorno muestreadas deben tener un valor por fila o por columna");
+    }
+
+    Q.assign(q);
+
+    //  Sin las funciones, la próxima llamada con una ecuación vuelve a muestrear todos los bordes
+    BCL = BCR = BCT = BCB = nullptr;
+    if (bc & BCL_df) {
+        left = boundaries.l;
+    }
+    if (bc & BCR_df) {
+        right = boundaries.r;
+    }
+    if (bc & BCT_df) {
+        top = boundaries.t;
+    }
+    if (bc & BCB_df) {
+        bottom = boundaries.b;
+    }
+}
+
+template class cda::math::differential_equations::BasicWaveSolver2D<DoublePrecision>;
+template class cda::math::differential_equations::BasicWaveSolver2D<SinglePrecision>;
+template class cda::math::differential_equations::BasicWaveSolver2D<MixedPrecision>;
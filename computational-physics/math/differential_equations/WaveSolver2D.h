@@ -0,0 +1,100 @@
+//
+//  WaveSolver2D.h
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include "SolveEDP.h"
+#include "CoefficientField.h"
+#include "WaveGrid2D.h"
+
+
+namespace cda {
+    namespace math {
+        namespace differential_equations {
+
+            //  -- ECUACIÓN DE ONDAS EN 2 DIMENSIONES CON ESTADO --
+            //  Resuelve ∂²u/∂t² = Q(x,y)·∆u con el mismo esquema y condiciones de contorno que EDP::solveWAVE.
+            //  Las mallas y el avance en el tiempo están en WaveGrid2D.
+            //
+            //  Q2D y las condiciones de contorno se muestrean al construirlo, así que el bucle interior no
+            //  llama a ninguna función. Si Q2D es constante el bucle ni siquiera lee la malla de coeficientes.
+            //
+            //  Las condiciones de contorno se eligen en tiempo de ejecución. Si se conocen al compilar,
+            //  StaticWaveSolver2D genera un núcleo específico para ellas.
+            //
+            //  Precision (Precision.h) elige el tipo de las mallas y de las operaciones. WaveSolver2D es la
+            //  versión en double; BasicWaveSolver2D<SinglePrecision> guarda y calcula en float.
+            template <typename Precision>
+            class BasicWaveSolver2D : public WaveGrid2D<Precision> {
+            public:
+                typedef typename Precision::value_type value_type;
+
+                /**
+                 @param equation Ecuación de la que se toman Q2D, BCL, BCR, BCT, BCB, dt y time
+                 @param bc Condiciones de contorno (BCx_df). Los bordes sin condición en la derivada no cambian
+                 @param x Coordenadas de las columnas
+                 @param y Coordenadas de las filas
+                 @param cI Condición inicial
+                 @param cId Derivada temporal inicial
+                 @param fixed Puntos que no evolucionan
+                 */
+                BasicWaveSolver2D(const EDP &equation, unsigned char bc,
+                                  const containers::Vector<EDP_T> &x, const containers::Vector<EDP_T> &y,
+                                  const containers::Matrix<EDP_T> &cI, const containers::Matrix<EDP_T> &cId,
+                                  const containers::Matrix<bool> &fixed);
+
+                /**
+                 Con Q2D y las condiciones de contorno ya muestreadas en la malla (p. ej. por otro proceso).
+                 No se comprueba la condición CFL: \p dt debe ser estable
+
+                 @param q Q2D en cada punto (y[i], x[j])
+                 @param boundaries Condiciones de contorno de los bordes con condición en la derivada:
+                 left y right en cada fila, top y bottom en cada columna
+                 */
+                BasicWaveSolver2D(EDP_T time, EDP_T dt, unsigned char bc,
+                                  const containers::Vector<EDP_T> &x, const containers::Vector<EDP_T> &y,
+                                  const containers::Matrix<EDP_T> &cI, const containers::Matrix<EDP_T> &cId,
+                                  const containers::Matrix<bool> &fixed,
+                                  const containers::Matrix<EDP_T> &q, const wave::SampledBoundaries &boundaries);
+
+                /**
+                 Avanza \p steps pasos de tiempo
+                 */
+                void step(size_t steps = 1);
+
+                /**
+                 Toma Q2D, BCL, BCR, BCT y BCB de \p equation y las vuelve a muestrear
+
+                 @param cache Si es true (opción CACHE_COEFFICIENTS) sólo se muestrean las funciones que han cambiado.
+                 Sin la opción se muestrean siempre, porque pueden depender de variables que cambian entre llamadas
+                 */
+                void setCoefficients(const EDP &equation, bool cache = false);
+
+                /**
+                 Toma Q2D y las condiciones de contorno ya muestreadas (ver el constructor)
+                 */
+                void setCoefficients(const containers::Matrix<EDP_T> &q, const wave::SampledBoundaries &boundaries);
+
+                const BasicCoefficientField<value_type> &coefficients() const { return Q; }
+
+            private:
+
+                unsigned char bc;
+
+                EDP_T (* BCL)(EDP_T x, EDP_T y), (* BCR)(EDP_T x, EDP_T y), (* BCT)(EDP_T x, EDP_T y), (* BCB)(EDP_T x, EDP_T y);
+
+                //  Q2D y condiciones de contorno muestreadas en la malla (y en cada borde)
+                BasicCoefficientField<value_type> Q;
+                containers::Vector<EDP_T> left, right, top, bottom;
+            };
+
+            typedef BasicWaveSolver2D<DoublePrecision> WaveSolver2D;
+
+        } /* namespace differential_equations */
+    } /* namespace math */
+} /* namespace cda */
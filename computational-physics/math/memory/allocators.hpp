@@ -0,0 +1,262 @@
+//
+//  allocators.hpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "../parallel/team.hpp"
+
+
+//  Default alignment of Matrix and Vector elements (one cache line, one AVX-512 register)
+#define CDA_MEMORY_ALIGNMENT 64
+
+//  Size and alignment of transparent huge pages
+#define CDA_HUGE_PAGE_SIZE 2097152
+
+
+namespace cda {
+    namespace math {
+        namespace memory {
+
+            /**
+             Process-wide counters of the blocks requested by the allocators of this file.
+             Reading them before and after a loop proves it does not touch the heap.
+             */
+            struct AllocationCounters {
+                std::atomic<size_t> allocations;
+                std::atomic<size_t> deallocations;
+                std::atomic<size_t> bytes;
+            };
+
+            inline AllocationCounters &allocation_counters() {
+                static AllocationCounters counters{{0}, {0}, {0}};
+                return counters;
+            }
+
+            /**
+             Number of blocks allocated so far
+             */
+            inline size_t allocation_count() {
+                return allocation_counters().allocations.load(std::memory_order_relaxed);
+            }
+
+            /**
+             Allocates \p bytes aligned to \p alignment
+
+             @throw std::bad_alloc if memory could not be allocated
+             */
+            inline void *aligned_allocate(const size_t &bytes, const size_t &alignment) {
+                void *memory = nullptr;
+                if (posix_memalign(&memory, std::max(alignment, sizeof(void *)), bytes) != 0) {
+                    throw std::bad_alloc();
+                }
+
+                AllocationCounters &counters = allocation_counters();
+                counters.allocations.fetch_add(1, std::memory_order_relaxed);
+                counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+                return memory;
+            }
+
+            inline void aligned_deallocate(void *memory) {
+                if (memory) {
+                    allocation_counters().deallocations.fetch_add(1, std::memory_order_relaxed);
+                    std::free(memory);
+                }
+            }
+
+            /**
+             Allocator returning memory aligned to \p Alignment bytes,
+             so SIMD code can use aligned loads from the first element.
+
+             Allocators are stateless policies: containers create them on demand.
+             */
+            template <typename T, size_t Alignment = CDA_MEMORY_ALIGNMENT>
+            class AlignedAllocator {
+                static_assert(Alignment && !(Alignment & (Alignment - 1)), "Alignment must be a power of two");
+
+            public:
+                typedef T value_type;
+                static constexpr size_t alignment = Alignment;
+
+                template <typename U>
+                struct rebind {
+                    typedef AlignedAllocator<U, Alignment> other;
+                };
+
+                AlignedAllocator() = default;
+
+                template <typename U>
+                AlignedAllocator(const AlignedAllocator<U, Alignment> &) {
+                }
+
+                T *allocate(const size_t &size) const {
+                    return static_cast<T *>(aligned_allocate(size * sizeof(T), Alignment));
+                }
+
+                void deallocate(T *pointer, const size_t &) const {
+                    aligned_deallocate(pointer);
+                }
+            };
+
+            /**
+             Allocator backing large blocks with transparent huge pages.
+
+             Blocks of at least one huge page are aligned to CDA_HUGE_PAGE_SIZE and
+             marked with madvise(MADV_HUGEPAGE), which reduces TLB misses when sweeping
+             large grids. Smaller blocks, and systems without THP, fall back to
+             AlignedAllocator.
+             */
+            template <typename T>
+            class HugePageAllocator {
+            public:
+                typedef T value_type;
+                static constexpr size_t alignment = CDA_MEMORY_ALIGNMENT;
+
+                template <typename U>
+                struct rebind {
+                    typedef HugePageAllocator<U> other;
+                };
+
+                HugePageAllocator() = default;
+
+                template <typename U>
+                HugePageAllocator(const HugePageAllocator<U> &) {
+                }
+
+                T *allocate(const size_t &size) const {
+                    const size_t bytes = size * sizeof(T);
+                    if (bytes < CDA_HUGE_PAGE_SIZE) {
+                        return static_cast<T *>(aligned_allocate(bytes, alignment));
+                    }
+
+                    //  Round up so the last huge page is not shared with other allocations
+                    const size_t pages = (bytes + CDA_HUGE_PAGE_SIZE - 1) / CDA_HUGE_PAGE_SIZE;
+                    void *memory = aligned_allocate(pages * CDA_HUGE_PAGE_SIZE, CDA_HUGE_PAGE_SIZE);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+                    madvise(memory, pages * CDA_HUGE_PAGE_SIZE, MADV_HUGEPAGE);
+#endif
+                    return static_cast<T *>(memory);
+                }
+
+                void deallocate(T *pointer, const size_t &) const {
+                    aligned_deallocate(pointer);
+                }
+            };
+
+            /**
+             Allocator spreading the pages of a block over the NUMA nodes of Team::shared().
+
+             Operating systems map a page on the node of the first thread writing to it, so
+             the new block is zeroed by the members of the shared team, each one writing the
+             part Team::Member::range() gives it. Loops splitting the block (or its rows) the
+             same way on the same team, as the wave and Poisson solvers do with evenly sized bands,
+             then read mostly local memory. Work-stealing loops of ThreadPool get no such guarantee.
+             */
+            template <typename T, typename Base = AlignedAllocator<T>>
+            class FirstTouchAllocator {
+            public:
+                typedef T value_type;
+                static constexpr size_t alignment = Base::alignment;
+
+                template <typename U>
+                struct rebind {
+                    typedef FirstTouchAllocator<U, typename Base::template rebind<U>::other> other;
+                };
+
+                FirstTouchAllocator() = default;
+
+                template <typename U, typename OtherBase>
+                FirstTouchAllocator(const FirstTouchAllocator<U, OtherBase> &) {
+                }
+
+                T *allocate(const size_t &size) const {
+                    static_assert(std::is_trivial<T>::value, "First touch allocation requires trivial types");
+
+                    T *pointer = Base().allocate(size);
+                    parallel::Team::shared().for_each(0, size, [pointer](const size_t &from, const size_t &to) {
+                        std::memset(static_cast<void *>(pointer + from), 0, (to - from) * sizeof(T));
+                    });
+                    return pointer;
+                }
+
+                void deallocate(T *pointer, const size_t &size) const {
+                    Base().deallocate(pointer, size);
+                }
+            };
+
+            template <typename T, size_t Alignment, typename U>
+            bool operator==(const AlignedAllocator<T, Alignment> &, const AlignedAllocator<U, Alignment> &) {
+                return true;
+            }
+
+            template <typename T, size_t Alignment, typename U>
+            bool operator!=(const AlignedAllocator<T, Alignment> &, const AlignedAllocator<U, Alignment> &) {
+                return false;
+            }
+
+            template <typename T, typename U>
+            bool operator==(const HugePageAllocator<T> &, const HugePageAllocator<U> &) {
+                return true;
+            }
+
+            template <typename T, typename U>
+            bool operator!=(const HugePageAllocator<T> &, const HugePageAllocator<U> &) {
+                return false;
+            }
+
+            template <typename T, typename Base, typename U, typename OtherBase>
+            bool operator==(const FirstTouchAllocator<T, Base> &, const FirstTouchAllocator<U, OtherBase> &) {
+                return true;
+            }
+
+            template <typename T, typename Base, typename U, typename OtherBase>
+            bool operator!=(const FirstTouchAllocator<T, Base> &, const FirstTouchAllocator<U, OtherBase> &) {
+                return false;
+            }
+
+            /**
+             Resizes a block keeping its first min(\p old_size, \p new_size) elements,
+             as std::realloc does for malloc'ed memory.
+
+             @return The new block, or nullptr if \p new_size is zero
+             */
+            template <typename Allocator>
+            typename Allocator::value_type *reallocate(Allocator allocator,
+                                                       typename Allocator::value_type *pointer,
+                                                       const size_t &old_size, const size_t &new_size) {
+                typedef typename Allocator::value_type value_type;
+                static_assert(std::is_trivially_copyable<value_type>::value, "Elements are moved with memcpy");
+
+                if (new_size == old_size && pointer) {
+                    return pointer;
+                }
+
+                value_type *new_pointer = new_size ? allocator.allocate(new_size) : nullptr;
+                if (pointer) {
+                    if (new_pointer) {
+                        std::memcpy(static_cast<void *>(new_pointer), pointer,
+                                    std::min(old_size, new_size) * sizeof(value_type));
+                    }
+                    allocator.deallocate(pointer, old_size);
+                }
+                return new_pointer;
+            }
+
+        } /* namespace memory */
+    } /* namespace math */
+} /* namespace cda */
@@ -0,0 +1,100 @@
+//
+//  pool.hpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+
+namespace cda {
+    namespace math {
+        namespace memory {
+
+            /**
+             Recycles Matrix or Vector buffers between iterations of a time loop.
+
+             acquire() hands out an idle container with the requested dimensions, and only
+             allocates when none is available. Containers given back with release() are
+             reused by later calls. After the first steps, a loop that releases everything
+             it acquires runs without heap allocations; allocations() tells how many
+             containers had to be created.
+
+             The contents of an acquired container are not specified.
+             */
+            template <typename Container>
+            class Pool {
+            private:
+                std::vector<Container> idle;
+                size_t misses;
+
+                static bool fits(const Container &container, const size_t &rows, const size_t &columns) {
+                    return container.rows() == rows && container.columns() == columns;
+                }
+
+                static bool fits(const Container &container, const size_t &size) {
+                    return container.size() == size;
+                }
+
+            public:
+                Pool() : misses(0) {
+                }
+
+                Pool(const Pool &) = delete;
+                Pool &operator=(const Pool &) = delete;
+
+                /**
+                 Returns a container with the given dimensions: (rows, columns) for matrices,
+                 (size) for vectors
+                 */
+                template <typename... Dimensions>
+                Container acquire(const Dimensions &... dimensions) {
+                    for (auto it = idle.begin(); it != idle.end(); ++it) {
+                        if (fits(*it, dimensions...)) {
+                            Container container(std::move(*it));
+                            *it = std::move(idle.back());
+                            idle.pop_back();
+                            return container;
+                        }
+                    }
+
+                    ++misses;
+                    return Container(dimensions...);
+                }
+
+                /**
+                 Gives a container back to the pool. Empty containers are discarded.
+                 */
+                void release(Container &&container) {
+                    if (!container.is_empty()) {
+                        idle.push_back(std::move(container));
+                    }
+                }
+
+                /**
+                 Number of containers created because no idle one fitted
+                 */
+                size_t allocations() const {
+                    return misses;
+                }
+
+                /**
+                 Number of idle containers
+                 */
+                size_t size() const {
+                    return idle.size();
+                }
+
+                void clear() {
+                    idle.clear();
+                }
+            };
+
+        } /* namespace memory */
+    } /* namespace math */
+} /* namespace cda */
@@ -0,0 +1,520 @@
+//
+//  team.hpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "thread_pool.hpp"
+
+
+//  Number of polls a team thread spins before going to sleep while it waits for work
+#define CDA_TEAM_SPIN 4096
+
+//  Minimum number of elements worth handing to each member of a team
+#define CDA_TEAM_GRAIN 4096
+
+
+namespace cda {
+    namespace math {
+        namespace parallel {
+
+            /**
+             Hint to the processor that the calling thread is busy-waiting
+             */
+            inline void cpu_relax() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+                _mm_pause();
+#elif defined(__aarch64__)
+                asm volatile("yield");
+#else
+                std::this_thread::yield();
+#endif
+            }
+
+            /**
+             Where the members of a team run
+             */
+            enum class Affinity {
+                none,       //  Wherever the operating system schedules them
+                compact,    //  Member i pinned to the i-th CPU the process may use
+                spread      //  Consecutive members grouped on the same NUMA node, with the nodes sharing the team evenly
+            };
+
+            /**
+             Fixed group of long-lived threads running the same function in lockstep
+             (fork-join with a barrier), meant for stencils that advance many small steps.
+
+             Unlike ThreadPool, handing out work neither allocates nor takes locks:
+             run() publishes a function pointer and bumps a generation counter that the
+             members are spinning on, and completion is an atomic countdown. Members
+             go to sleep after CDA_TEAM_SPIN polls without work, so an idle team does
+             not burn CPU; the first run() after that pays a regular wake-up.
+
+             Members can synchronise inside a run with Member::barrier(), so a loop
+             of dependent steps can run under a single run() call.
+             */
+            class Team {
+            public:
+                /**
+                 Identity of a thread inside run()
+                 */
+                class Member {
+                private:
+                    Team *team;
+                    size_t _index, _count;
+
+                    friend class Team;
+
+                    Member(Team *team, const size_t &index, const size_t &count) :
+                    team(team), _index(index), _count(count) {
+                    }
+
+                public:
+                    /**
+                     Position of the member, 0 is the thread that called run()
+                     */
+                    size_t index() const {
+                        return _index;
+                    }
+
+                    /**
+                     Number of members taking part in the run
+                     */
+                    size_t count() const {
+                        return _count;
+                    }
+
+                    /**
+                     Static partition of [begin, end) for this member
+                     */
+                    void range(const size_t &begin, const size_t &end, size_t &from, size_t &to) const {
+                        const size_t size = end > begin ? end - begin : 0;
+                        from = begin + size * _index / _count;
+                        to = begin + size * (_index + 1) / _count;
+                    }
+
+                    /**
+                     Waits until every member of the run reaches the barrier.
+                     Writes made before the barrier are visible to all members after it.
+                     */
+                    void barrier() const {
+                        if (_count > 1) {
+                            team->barrier(_count);
+                        }
+                    }
+                };
+
+            private:
+                typedef void (*Invoker)(const void *function, const Member &member);
+
+                template <typename Function>
+                static void invoke(const void *function, const Member &member) {
+                    (*static_cast<const Function *>(function))(member);
+                }
+
+                std::vector<std::thread> threads;
+
+                //  Current job. Counters polled by different threads live in their own cache lines
+                const void *function;
+                Invoker invoker;
+                size_t members;
+                alignas(64) std::atomic<size_t> generation;
+                alignas(64) std::atomic<size_t> remaining;
+
+                //  Barrier inside a job
+                alignas(64) std::atomic<size_t> arrived;
+                alignas(64) std::atomic<size_t> barrier_generation;
+
+                //  Sleeping members
+                std::mutex sleep_mutex;
+                std::condition_variable wake_up;
+                std::atomic<size_t> sleeping;
+                std::atomic<bool> stop;
+
+                //  Set while a run is in progress
+                std::atomic<bool> busy;
+
+                std::mutex error_mutex;
+                std::exception_ptr error;
+
+                static Team *&current_team() {
+                    thread_local Team *team = nullptr;
+                    return team;
+                }
+
+                void execute(const size_t &index) {
+                    if (index >= members) {
+                        return;
+                    }
+
+                    try {
+                        invoker(function, Member(this, index, members));
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if (!error) {
+                            error = std::current_exception();
+                        }
+                    }
+                }
+
+                void work(const size_t index) {
+                    current_team() = this;
+
+                    size_t seen = 0;
+                    while (true) {
+                        size_t current = generation.load(std::memory_order_acquire);
+                        for (size_t spin = 0; current == seen && spin < CDA_TEAM_SPIN && !stop.load(std::memory_order_relaxed); ++spin) {
+                            cpu_relax();
+                            current = generation.load(std::memory_order_acquire);
+                        }
+
+                        if (current == seen) {
+                            std::unique_lock<std::mutex> lock(sleep_mutex);
+                            ++sleeping;
+                            wake_up.wait(lock, [this, seen] { return stop.load() || generation.load() != seen; });
+                            --sleeping;
+                            current = generation.load(std::memory_order_acquire);
+                        }
+
+                        if (stop.load()) {
+                            return;
+                        }
+
+                        seen = current;
+                        execute(index);
+                        remaining.fetch_sub(1, std::memory_order_acq_rel);
+                    }
+                }
+
+                void barrier(const size_t &count) {
+                    const size_t current = barrier_generation.load(std::memory_order_acquire);
+                    if (arrived.fetch_add(1, std::memory_order_acq_rel) == count - 1) {
+                        arrived.store(0, std::memory_order_relaxed);
+                        barrier_generation.fetch_add(1, std::memory_order_acq_rel);
+                        return;
+                    }
+
+                    for (size_t spin = 0; barrier_generation.load(std::memory_order_acquire) == current; ++spin) {
+                        if (spin < CDA_TEAM_SPIN) {
+                            cpu_relax();
+                        } else {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+
+#if defined(__linux__)
+                //  CPUs in a list such as "0-3,8-11"
+                static std::vector<int> parse_cpus(const std::string &list) {
+                    std::vector<int> cpus;
+                    const char *it = list.c_str();
+                    while (*it) {
+                        char *end;
+                        const long first = std::strtol(it, &end, 10);
+                        if (end == it) {
+                            break;
+                        }
+                        long last = first;
+                        if (*end == '-') {
+                            it = end + 1;
+                            last = std::strtol(it, &end, 10);
+                        }
+                        for (long cpu = first; cpu <= last; ++cpu) {
+                            cpus.push_back(static_cast<int>(cpu));
+                        }
+                        it = *end == ',' ? end + 1 : end;
+                    }
+                    return cpus;
+                }
+
+                //  CPUs the calling thread may use, grouped by NUMA node
+                static std::vector<std::vector<int>> numa_nodes(const cpu_set_t &allowed) {
+                    std::vector<std::vector<int>> nodes;
+                    for (size_t node = 0; ; ++node) {
+                        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+                        if (!file) {
+                            break;
+                        }
+
+                        std::string list;
+                        std::getline(file, list);
+                        std::vector<int> cpus;
+                        for (const int &cpu : parse_cpus(list)) {
+                            if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)) {
+                                cpus.push_back(cpu);
+                            }
+                        }
+                        if (!cpus.empty()) {
+                            nodes.push_back(cpus);
+                        }
+                    }
+
+                    //  Without NUMA information every CPU is on the same node
+                    if (nodes.empty()) {
+                        nodes.emplace_back();
+                        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                            if (CPU_ISSET(cpu, &allowed)) {
+                                nodes.back().push_back(cpu);
+                            }
+                        }
+                    }
+                    return nodes;
+                }
+#endif
+
+            public:
+                /**
+                 Creates a team
+
+                 @param size Number of members, including the thread calling run()
+                 */
+                explicit Team(const size_t &size) :
+                function(nullptr), invoker(nullptr), members(0), generation(0), remaining(0),
+                arrived(0), barrier_generation(0), sleeping(0), stop(false), busy(false) {
+                    for (size_t i = 1; i < std::max<size_t>(size, 1); ++i) {
+                        threads.emplace_back(&Team::work, this, i);
+                    }
+                }
+
+                /**
+                 Creates a team and pins its members
+
+                 @param size Number of members, including the thread calling the constructor
+                 @param affinity Pinning policy, see pin()
+                 */
+                Team(const size_t &size, const Affinity &affinity) : Team(size) {
+                    pin(affinity);
+                }
+
+                Team(const Team &) = delete;
+                Team &operator=(const Team &) = delete;
+
+                ~Team() {
+                    {
+                        std::lock_guard<std::mutex> lock(sleep_mutex);
+                        stop = true;
+                    }
+                    wake_up.notify_all();
+                    for (auto &thread : threads) {
+                        thread.join();
+                    }
+                }
+
+                /**
+                 Process-wide team, with one member per hardware thread or CDA_NUM_THREADS members.
+                 With CDA_AFFINITY the thread that first calls shared() is pinned as member 0 (pin()).
+
+                 It runs the stencil solvers, whose bands must go to the same member on every step.
+                 Element-wise loops of Matrix and Vector run on ThreadPool::shared() instead, which
+                 several threads can use at once. Both sets of threads sleep while idle, so they
+                 only compete for the cores while two threads drive them at the same time.
+                 */
+                static Team &shared() {
+                    static Team team(ThreadPool::default_workers() + 1, default_affinity());
+                    return team;
+                }
+
+                /**
+                 Pinning policy of Team::shared(), taken from the CDA_AFFINITY environment
+                 variable: "compact", "spread" or, by default, none
+                 */
+                static Affinity default_affinity() {
+                    if (const char *affinity = std::getenv("CDA_AFFINITY")) {
+                        if (std::strcmp(affinity, "compact") == 0) {
+                            return Affinity::compact;
+                        }
+                        if (std::strcmp(affinity, "spread") == 0) {
+                            return Affinity::spread;
+                        }
+                    }
+                    return Affinity::none;
+                }
+
+                /**
+                 Makes every later run() started by the calling thread run serially, with a single member.
+
+                 A process created with fork() only has the thread that called fork(): it must call this
+                 before using a team created by its parent, whose other members do not exist there.
+                 */
+                static void run_serially() {
+                    static Team serial(1);
+                    current_team() = &serial;
+                }
+
+                /**
+                 Pins every member to one CPU, so each member keeps the same caches and NUMA node
+                 between runs. Member 0 is the thread calling run(), and only the thread calling
+                 pin() is pinned as member 0: run() never changes the affinity of its caller. A
+                 thread that drives the team later (e.g. a simulation thread started after it) and
+                 wants the same placement calls pin() itself.
+
+                 A partition of the data that always gives the same part to the same member
+                 (Member::range()) can then be initialised by that member: with first-touch page
+                 placement its pages end up on the member's node.
+
+                 Only available on Linux; elsewhere, and with Affinity::none, the members are not pinned.
+                 A member that was pinned before stays on its CPU with Affinity::none.
+                 */
+                void pin(const Affinity &affinity) {
+#if defined(__linux__)
+                    if (affinity == Affinity::none) {
+                        return;
+                    }
+
+                    cpu_set_t allowed;
+                    CPU_ZERO(&allowed);
+                    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+                        return;
+                    }
+
+                    const std::vector<std::vector<int>> nodes = numa_nodes(allowed);
+                    std::vector<int> cpus;
+                    const size_t count = size();
+                    if (affinity == Affinity::compact) {
+                        for (const auto &node : nodes) {
+                            cpus.insert(cpus.end(), node.begin(), node.end());
+                        }
+                        for (size_t i = 0; cpus.size() < count; ++i) {
+                            cpus.push_back(cpus[i]);
+                        }
+                    } else {
+                        //  Members [count·k/N, count·(k+1)/N) go to node k
+                        for (size_t k = 0; k < nodes.size(); ++k) {
+                            for (size_t i = count * k / nodes.size(); i < count * (k + 1) / nodes.size(); ++i) {
+                                cpus.push_back(nodes[k][(i - count * k / nodes.size()) % nodes[k].size()]);
+                            }
+                        }
+                    }
+
+                    run([&](const Member &member) {
+                        cpu_set_t set;
+                        CPU_ZERO(&set);
+                        CPU_SET(cpus[member.index()], &set);
+                        sched_setaffinity(0, sizeof(set), &set);
+                    });
+#else
+                    (void)affinity;
+#endif
+                }
+
+                /**
+                 Lets the calling thread run on any CPU again, e.g. in a process created with fork()
+                 by a pinned thread
+                 */
+                static void unpin() {
+#if defined(__linux__)
+                    //  CPUs outside the cpuset of the process are ignored
+                    cpu_set_t all;
+                    CPU_ZERO(&all);
+                    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                        CPU_SET(cpu, &all);
+                    }
+                    sched_setaffinity(0, sizeof(all), &all);
+#endif
+                }
+
+                /**
+                 Number of members, including the caller of run()
+                 */
+                size_t size() const {
+                    return threads.size() + 1;
+                }
+
+                /**
+                 Runs function(member) on the first \p count members and waits for all of them.
+
+                 Calls made from inside a run, or from a second thread while the team is
+                 busy, run the function serially with a single member. The first exception
+                 thrown by a member is rethrown here; functions using barrier() must not
+                 throw between barriers, or the other members would wait forever.
+
+                 @param function Callable with signature void(const Team::Member &)
+                 @param count Maximum number of members taking part
+                 */
+                template <typename Function>
+                void run(const Function &function, const size_t &count = SIZE_MAX) {
+                    bool idle = false;
+                    if (threads.empty() || count <= 1 || current_team() || !busy.compare_exchange_strong(idle, true)) {
+                        function(Member(this, 0, 1));
+                        return;
+                    }
+
+                    current_team() = this;
+                    this->function = &function;
+                    invoker = &Team::invoke<Function>;
+                    members = std::min(count, size());
+                    remaining.store(threads.size(), std::memory_order_relaxed);
+                    generation.fetch_add(1, std::memory_order_seq_cst);
+
+                    if (sleeping.load(std::memory_order_seq_cst) > 0) {
+                        std::lock_guard<std::mutex> lock(sleep_mutex);
+                        wake_up.notify_all();
+                    }
+
+                    execute(0);
+
+                    for (size_t spin = 0; remaining.load(std::memory_order_acquire) > 0; ++spin) {
+                        if (spin < CDA_TEAM_SPIN) {
+                            cpu_relax();
+                        } else {
+                            std::this_thread::yield();
+                        }
+                    }
+
+                    current_team() = nullptr;
+                    busy.store(false, std::memory_order_release);
+
+                    if (error) {
+                        std::exception_ptr exception = error;
+                        error = nullptr;
+                        std::rethrow_exception(exception);
+                    }
+                }
+
+                /**
+                 Runs function(from, to) over a static partition of [begin, end), one range per member
+
+                 @param grain Minimum number of indices per member
+                 */
+                template <typename Function>
+                void for_each(const size_t &begin, const size_t &end, const Function &function,
+                              const size_t &grain = CDA_TEAM_GRAIN) {
+                    const size_t count = end > begin ? (end - begin) / std::max<size_t>(grain, 1) : 0;
+                    run([&](const Member &member) {
+                        size_t from, to;
+                        member.range(begin, end, from, to);
+                        if (from < to) {
+                            function(from, to);
+                        }
+                    }, count);
+                }
+            };
+
+        } /* namespace parallel */
+    } /* namespace math */
+} /* namespace cda */
@@ -0,0 +1,296 @@
+//
+//  thread_pool.hpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+//  Minimum number of elements handled by a single task of an element-wise operation
+#define CDA_PARALLEL_GRAIN 32768
+
+
+namespace cda {
+    namespace math {
+        namespace parallel {
+
+            /**
+             Work-stealing thread pool.
+
+             Every worker owns a queue: it pops its own tasks from the back and steals
+             from the front of the others when it runs out of work. Threads waiting for
+             a parallel_for to finish run pending tasks instead of blocking, so nested
+             calls make progress and a pool without workers degrades to serial code.
+             */
+            class ThreadPool {
+            public:
+                /**
+                 Non-owning task: function(context, argument). Submitting one does not allocate,
+                 so \p context must outlive its execution (parallel_for() waits for its chunks).
+                 */
+                struct Task {
+                    void (*function)(const void *context, const size_t &argument);
+                    const void *context;
+                    size_t argument;
+
+                    void operator()() const {
+                        function(context, argument);
+                    }
+                };
+
+            private:
+                struct Queue {
+                    std::mutex mutex;
+                    std::deque<Task> tasks;
+                };
+
+                struct Worker {
+                    const ThreadPool *pool;
+                    size_t index;
+                };
+
+                std::vector<std::unique_ptr<Queue>> queues;
+                std::vector<std::thread> threads;
+
+                std::mutex sleep_mutex;
+                std::condition_variable wake_up;
+                std::atomic<size_t> pending;
+                std::atomic<size_t> next_queue;
+                bool stop;
+
+                static Worker &current_worker() {
+                    thread_local Worker worker{nullptr, 0};
+                    return worker;
+                }
+
+                bool pop(const size_t &index, Task &task) {
+                    Queue &queue = *queues[index];
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    if (queue.tasks.empty()) {
+                        return false;
+                    }
+                    task = queue.tasks.back();
+                    queue.tasks.pop_back();
+                    --pending;
+                    return true;
+                }
+
+                bool steal(const size_t &index, Task &task) {
+                    for (size_t i = 1; i <= queues.size(); ++i) {
+                        Queue &queue = *queues[(index + i) % queues.size()];
+                        std::unique_lock<std::mutex> lock(queue.mutex, std::try_to_lock);
+                        if (!lock.owns_lock() || queue.tasks.empty()) {
+                            continue;
+                        }
+                        task = queue.tasks.front();
+                        queue.tasks.pop_front();
+                        --pending;
+                        return true;
+                    }
+                    return false;
+                }
+
+                void work(const size_t index) {
+                    current_worker() = Worker{this, index};
+
+                    Task task;
+                    while (true) {
+                        if (pop(index, task) || steal(index, task)) {
+                            task();
+                            continue;
+                        }
+
+                        std::unique_lock<std::mutex> lock(sleep_mutex);
+                        wake_up.wait(lock, [this] { return stop || pending.load() > 0; });
+                        if (stop && pending.load() == 0) {
+                            return;
+                        }
+                    }
+                }
+
+            public:
+                /**
+                 Creates a pool
+
+                 @param workers Number of background threads. The thread calling parallel_for
+                 also executes tasks, so zero workers is a valid (serial) pool.
+                 */
+                explicit ThreadPool(const size_t &workers) :
+                pending(0), next_queue(0), stop(false) {
+                    for (size_t i = 0; i < std::max<size_t>(workers, 1); ++i) {
+                        queues.emplace_back(new Queue);
+                    }
+                    for (size_t i = 0; i < workers; ++i) {
+                        threads.emplace_back(&ThreadPool::work, this, i);
+                    }
+                }
+
+                ThreadPool(const ThreadPool &) = delete;
+                ThreadPool &operator=(const ThreadPool &) = delete;
+
+                ~ThreadPool() {
+                    {
+                        std::lock_guard<std::mutex> lock(sleep_mutex);
+                        stop = true;
+                    }
+                    wake_up.notify_all();
+                    for (auto &thread : threads) {
+                        thread.join();
+                    }
+                }
+
+                /**
+                 Process-wide pool shared by the math library.
+
+                 Its size is taken from the CDA_NUM_THREADS environment variable
+                 or, by default, from the number of hardware threads.
+                 */
+                static ThreadPool &shared() {
+                    static ThreadPool pool(default_workers());
+                    return pool;
+                }
+
+                static size_t default_workers() {
+                    if (const char *threads = std::getenv("CDA_NUM_THREADS")) {
+                        const long value = std::atol(threads);
+                        return value > 1 ? static_cast<size_t>(value - 1) : 0;
+                    }
+                    const size_t hardware = std::thread::hardware_concurrency();
+                    return hardware > 1 ? hardware - 1 : 0;
+                }
+
+                /**
+                 Number of threads executing tasks, including the caller
+                 */
+                size_t concurrency() const {
+                    return threads.size() + 1;
+                }
+
+                void submit(const Task &task) {
+                    const Worker &worker = current_worker();
+                    const size_t index = worker.pool == this ? worker.index : next_queue++ % queues.size();
+
+                    {
+                        Queue &queue = *queues[index];
+                        std::lock_guard<std::mutex> lock(queue.mutex);
+                        queue.tasks.push_back(task);
+                        ++pending;
+                    }
+
+                    std::lock_guard<std::mutex> lock(sleep_mutex);
+                    wake_up.notify_one();
+                }
+
+                /**
+                 Runs one pending task in the calling thread
+
+                 @return false if there was no task to run
+                 */
+                bool run_pending_task() {
+                    const Worker &worker = current_worker();
+                    const size_t index = worker.pool == this ? worker.index : 0;
+
+                    Task task;
+                    if (pop(index, task) || steal(index, task)) {
+                        task();
+                        return true;
+                    }
+                    return false;
+                }
+
+                /**
+                 Splits [begin, end) into chunks and runs function(from, to) on each of them
+
+                 @param begin First index
+                 @param end Last index (not included)
+                 @param function Callable with signature void(size_t from, size_t to)
+                 @param grain Minimum number of indices per chunk
+                 */
+                template <typename Function>
+                void parallel_for(const size_t &begin, const size_t &end, const Function &function,
+                                  const size_t &grain = 1) {
+                    if (end <= begin) {
+                        return;
+                    }
+
+                    const size_t count = end - begin;
+                    const size_t max_chunks = (count + std::max<size_t>(grain, 1) - 1) / std::max<size_t>(grain, 1);
+                    const size_t chunks = std::min(max_chunks, 4 * concurrency());
+
+                    if (threads.empty() || chunks <= 1) {
+                        function(begin, end);
+                        return;
+                    }
+
+                    std::atomic<size_t> remaining(chunks);
+                    std::exception_ptr error;
+                    std::mutex error_mutex;
+
+                    auto run_chunk = [&](const size_t &chunk) {
+                        const size_t from = begin + count * chunk / chunks;
+                        const size_t to = begin + count * (chunk + 1) / chunks;
+                        try {
+                            function(from, to);
+                        } catch (...) {
+                            std::lock_guard<std::mutex> lock(error_mutex);
+                            if (!error) {
+                                error = std::current_exception();
+                            }
+                        }
+                        --remaining;
+                    };
+
+                    typedef decltype(run_chunk) Chunk;
+                    for (size_t chunk = 1; chunk < chunks; ++chunk) {
+                        submit(Task{[](const void *context, const size_t &chunk) {
+                            (*static_cast<const Chunk *>(context))(chunk);
+                        }, &run_chunk, chunk});
+                    }
+                    run_chunk(0);
+
+                    while (remaining.load() > 0) {
+                        if (!run_pending_task()) {
+                            std::this_thread::yield();
+                        }
+                    }
+
+                    if (error) {
+                        std::rethrow_exception(error);
+                    }
+                }
+            };
+
+            /**
+             Runs function(from, to) over [begin, end) on the shared pool.
+             Ranges shorter than two grains run serially in the calling thread.
+             */
+            template <typename Function>
+            inline void parallel_for(const size_t &begin, const size_t &end, const Function &function,
+                                     const size_t &grain = CDA_PARALLEL_GRAIN) {
+                if (end <= begin) {
+                    return;
+                }
+                if (end - begin < 2 * grain) {
+                    function(begin, end);
+                    return;
+                }
+                ThreadPool::shared().parallel_for(begin, end, function, grain);
+            }
+
+        } /* namespace parallel */
+    } /* namespace math */
+} /* namespace cda */
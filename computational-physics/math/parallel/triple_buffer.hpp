@@ -0,0 +1,98 @@
+//
+//  triple_buffer.hpp
+//  Computational Physics
+//
+//  Created by Carlos David on 16/10/2026.
+//  Copyright © 2026 cdalvaro. All rights reserved.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+
+namespace cda {
+    namespace math {
+        namespace parallel {
+
+            /**
+             Lock-free handoff of whole frames from one producer thread to one consumer thread.
+
+             There are three slots: the producer fills the back one, the consumer reads the
+             front one and the third one holds the latest published frame. publish() and
+             update() only exchange slot indices through one atomic, so neither thread ever
+             waits for the other nor copies a frame. The consumer always gets the newest
+             frame; the ones it did not take in time are overwritten.
+             */
+            template <typename T>
+            class TripleBuffer {
+            public:
+
+                /**
+                 All three slots start as copies of \p value, e.g. an empty frame with the right size
+                 */
+                explicit TripleBuffer(const T &value = T()) :
+                    slots{value, value, value},
+                    back_index(0), front_index(1), middle(2) {
+
+                }
+
+                TripleBuffer(const TripleBuffer &) = delete;
+                TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+                /**
+                 Slot the producer writes the next frame into
+                 */
+                T &back() {
+                    return slots[back_index];
+                }
+
+                /**
+                 Hands the back slot over to the consumer and takes the spare one as the new back slot.
+                 The new back slot holds an older frame, not the one just published
+                 */
+                void publish() {
+                    back_index = middle.exchange(back_index | fresh, std::memory_order_acq_rel) & index;
+                }
+
+                /**
+                 Takes the latest published frame as the front slot, if there is one the consumer has not seen
+
+                 @return true if front() has changed
+                 */
+                bool update() {
+                    if ((middle.load(std::memory_order_relaxed) & fresh) == 0) {
+                        return false;
+                    }
+
+                    front_index = middle.exchange(front_index, std::memory_order_acq_rel) & index;
+                    return true;
+                }
+
+                /**
+                 Slot the consumer reads. It is not touched by the producer until the next update()
+                 */
+                T &front() {
+                    return slots[front_index];
+                }
+
+                const T &front() const {
+                    return slots[front_index];
+                }
+
+            private:
+                static constexpr uint8_t index = 0x03;
+                static constexpr uint8_t fresh = 0x04;
+
+                T slots[3];
+
+                //  Producer and consumer own one slot each; middle holds the spare index and the fresh flag
+                alignas(64) uint8_t back_index;
+                alignas(64) uint8_t front_index;
+                alignas(64) std::atomic<uint8_t> middle;
+            };
+
+        } /* namespace parallel */
+    } /* namespace math */
+} /* namespace cda */